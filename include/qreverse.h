@@ -0,0 +1,46 @@
+#ifndef QREVERSE_H
+#define QREVERSE_H
+#include <stddef.h>
+
+/*
+C interface to qReverse, provided by the qreverse library. The library
+carries the kernels of every tier and picks the fastest one that the running
+processor supports, so callers get the vectorized paths without compiling for
+a particular instruction set themselves.
+
+Define QREVERSE_SHARED when linking against the shared library on Windows.
+*/
+
+#if defined(_WIN32) && defined(QREVERSE_SHARED)
+	#if defined(QREVERSE_BUILD)
+		#define QREVERSE_API __declspec(dllexport)
+	#else
+		#define QREVERSE_API __declspec(dllimport)
+	#endif
+#elif defined(__GNUC__) || defined(__clang__)
+	#define QREVERSE_API __attribute__((visibility("default")))
+#else
+	#define QREVERSE_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Reverses Count elements of the designated size in-place
+QREVERSE_API void qreverse_u8(void* Array, size_t Count);
+QREVERSE_API void qreverse_u16(void* Array, size_t Count);
+QREVERSE_API void qreverse_u32(void* Array, size_t Count);
+QREVERSE_API void qreverse_u64(void* Array, size_t Count);
+QREVERSE_API void qreverse_u128(void* Array, size_t Count);
+
+// Reverses Count elements of ElementSize bytes each in-place. Sizes that
+// qReverse has kernels for are dispatched to them, any other size is
+// exchanged an element at a time.
+QREVERSE_API void qreverse_n(void* Array, size_t Count, size_t ElementSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,897 +1,3055 @@
-#pragma once
-#include <cstdint>
-#include <cstddef>
-
-// x86
-#if defined(__i386__) || defined(__x86_64__)
-	#if defined(_MSC_VER)
-	
-	#include <intrin.h>
-	
-	inline std::uint64_t Swap64(std::uint64_t x)
-	{
-		return _byteswap_uint64(x);
-	}
-	
-	inline std::uint32_t Swap32(std::uint32_t x)
-	{
-		return _byteswap_ulong(x);
-	}
-	
-	inline std::uint16_t Swap16(std::uint16_t x)
-	{
-		return _byteswap_ushort(x);
-	}
-	
-	#elif defined(__GNUC__) || defined(__clang__)
-	
-	#include <x86intrin.h>
-	
-	inline std::uint64_t Swap64(std::uint64_t x)
-	{
-		return __builtin_bswap64(x);
-	}
-	
-	inline std::uint32_t Swap32(std::uint32_t x)
-	{
-		return __builtin_bswap32(x);
-	}
-	
-	inline std::uint16_t Swap16(std::uint16_t x)
-	{
-		return __builtin_bswap16(x);
-	}
-
-	#endif
-
-// ARM
-#elif defined(__ARM_NEON)
-
-	#include <arm_neon.h>
-
-	#if defined(_MSC_VER)
-	
-	inline std::uint64_t Swap64(std::uint64_t x)
-	{
-		return _byteswap_uint64(x);
-	}
-	
-	inline std::uint32_t Swap32(std::uint32_t x)
-	{
-		return _byteswap_ulong(x);
-	}
-	
-	inline std::uint16_t Swap16(std::uint16_t x)
-	{
-		return _byteswap_ushort(x);
-	}
-	
-	#elif defined(__GNUC__) || defined(__clang__)
-	
-	inline std::uint64_t Swap64(std::uint64_t x)
-	{
-		return __builtin_bswap64(x);
-	}
-	
-	inline std::uint32_t Swap32(std::uint32_t x)
-	{
-		return __builtin_bswap32(x);
-	}
-	
-	inline std::uint16_t Swap16(std::uint16_t x)
-	{
-		return __builtin_bswap16(x);
-	}
-
-	#endif
-
-// Pure
-#else
-
-inline std::uint64_t Swap64(std::uint64_t x)
-{
-	return (
-		((x & 0x00000000000000FF) << 56) |
-		((x & 0x000000000000FF00) << 40) |
-		((x & 0x0000000000FF0000) << 24) |
-		((x & 0x00000000FF000000) <<  8) |
-		((x & 0x000000FF00000000) >>  8) |
-		((x & 0x0000FF0000000000) >> 24) |
-		((x & 0x00FF000000000000) >> 40) |
-		((x & 0xFF00000000000000) >> 56)
-	);
-}
-
-inline std::uint32_t Swap32(std::uint32_t x)
-{
-	return(
-		((x & 0x000000FF) << 24) |
-		((x & 0x0000FF00) <<  8) |
-		((x & 0x00FF0000) >>  8) |
-		((x & 0xFF000000) >> 24)
-	);
-}
-
-inline std::uint16_t Swap16(std::uint16_t x)
-{
-	return (
-		((x & 0x00FF) << 8) |
-		((x & 0xFF00) >> 8)
-	);
-}
-
-#endif
-
-template< std::size_t ElementSize >
-inline void qReverse(void* Array, std::size_t Count)
-{
-	// An abstraction to treat the array elements purely as bytes
-	struct ByteElement
-	{
-		std::uint8_t u8[ElementSize];
-	};
-	ByteElement* ArrayN = reinterpret_cast<ByteElement*>(Array);
-
-	// If compiler adds any padding/alignment bytes(and some do) then assert out
-	static_assert(
-		sizeof(ByteElement) == ElementSize,
-		"ByteElement is pad-aligned and does not match specified element size"
-	);
-
-	// We're only iterating through half of the size of the Array
-	for( std::size_t i = 0; i < Count / 2; ++i )
-	{
-		// Exchange the upper and lower element as we work our
-		// way down to the middle from either end
-		ByteElement Temp(ArrayN[i]);
-		ArrayN[i] = ArrayN[Count - i - 1];
-		ArrayN[Count - i - 1] = Temp;
-	}
-}
-
-// One byte elements
-template<>
-inline void qReverse<1>(void* Array, std::size_t Count)
-{
-	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
-	std::size_t i = 0;
-	// AVX-512BW/F
-#if defined(__AVX512F__) && defined(__AVX512BW__)
-	for( std::size_t j = i / 64; j < ((Count / 2) / 64); ++j )
-	{
-		// Reverses the 16 bytes of the four  128-bit lanes in a 512-bit register
-		const __m512i ShuffleRev8 = _mm512_set_epi32(
-			0x00010203, 0x4050607, 0x8090a0b, 0xc0d0e0f,
-			0x00010203, 0x4050607, 0x8090a0b, 0xc0d0e0f,
-			0x00010203, 0x4050607, 0x8090a0b, 0xc0d0e0f,
-			0x00010203, 0x4050607, 0x8090a0b, 0xc0d0e0f
-		);
-
-		// Reverses the four 128-bit lanes of a 512-bit register
-		const __m512i ShuffleRev64 = _mm512_set_epi64(
-			1,0,3,2,5,4,7,6
-		);
-
-		// Load 64 elements at once into one 64-byte register
-		__m512i Lower = _mm512_loadu_si512(
-			reinterpret_cast<__m512i*>(&Array8[i])
-		);
-		__m512i Upper = _mm512_loadu_si512(
-			reinterpret_cast<__m512i*>(&Array8[Count - i - 64])
-		);
-
-		// Reverse the byte order of each 128-bit lane
-		Lower = _mm512_shuffle_epi8(Lower,ShuffleRev8);
-		Upper = _mm512_shuffle_epi8(Upper,ShuffleRev8);
-
-		// Reverse the four 128-bit lanes in the 512-bit register
-		Lower = _mm512_permutexvar_epi64(ShuffleRev64,Lower);
-		Upper = _mm512_permutexvar_epi64(ShuffleRev64,Upper);
-
-		// Place them at their swapped position
-		_mm512_storeu_si512(
-			reinterpret_cast<__m512i*>(&Array8[i]),
-			Upper
-		);
-		_mm512_storeu_si512(
-			reinterpret_cast<__m512i*>(&Array8[Count - i - 64]),
-			Lower
-		);
-
-		// 64 elements at a time
-		i += 64;
-	}
-#endif
-	// AVX-2
-#if defined(__AVX2__)
-	for( std::size_t j = i / 32; j < ((Count / 2) / 32); ++j )
-	{
-		const __m256i ShuffleRev = _mm256_set_epi8(
-			0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15,
-			0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15
-		);
-		// Load 32 elements at once into one 32-byte register
-		__m256i Lower = _mm256_loadu_si256(
-			reinterpret_cast<__m256i*>(&Array8[i])
-		);
-		__m256i Upper = _mm256_loadu_si256(
-			reinterpret_cast<__m256i*>(&Array8[Count - i - 32])
-		);
-
-		// Reverse the byte order of our 32-byte vectors
-		Lower = _mm256_shuffle_epi8(Lower,ShuffleRev);
-		Upper = _mm256_shuffle_epi8(Upper,ShuffleRev);
-
-		Lower = _mm256_permute2x128_si256(Lower,Lower,1);
-		Upper = _mm256_permute2x128_si256(Upper,Upper,1);
-
-		// Place them at their swapped position
-		_mm256_storeu_si256(
-			reinterpret_cast<__m256i*>(&Array8[i]),
-			Upper
-		);
-		_mm256_storeu_si256(
-			reinterpret_cast<__m256i*>(&Array8[Count - i - 32]),
-			Lower
-		);
-
-		// 32 elements at a time
-		i += 32;
-	}
-#endif
-	// SSSE3
-#if defined(__SSSE3__)
-	for( std::size_t j = i / 16; j < ((Count / 2) / 16); ++j )
-	{
-		const __m128i ShuffleRev = _mm_set_epi8(
-			0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
-		);
-		// Load 16 elements at once into one 16-byte register
-		__m128i Lower = _mm_loadu_si128(
-			reinterpret_cast<__m128i*>(&Array8[i])
-		);
-		__m128i Upper = _mm_loadu_si128(
-			reinterpret_cast<__m128i*>(&Array8[Count - i - 16])
-		);
-
-		// Reverse the byte order of our 16-byte vectors
-		Lower = _mm_shuffle_epi8(Lower, ShuffleRev);
-		Upper = _mm_shuffle_epi8(Upper, ShuffleRev);
-
-		// Place them at their swapped position
-		_mm_storeu_si128(
-			reinterpret_cast<__m128i*>(&Array8[i]),
-			Upper
-		);
-		_mm_storeu_si128(
-			reinterpret_cast<__m128i*>(&Array8[Count - i - 16]),
-			Lower
-		);
-
-		// 16 elements at a time
-		i += 16;
-	}
-#endif
-	// NEON
-#if defined(__ARM_NEON)
-	for( std::size_t j = i / 16; j < ((Count / 2) / 16); ++j )
-	{
-		// Load 16 elements at once into one 16-byte register
-		uint8x16_t Lower = vld1q_u8( &Array8[i] );
-		uint8x16_t Upper = vld1q_u8( &Array8[Count - i - 16] );
-
-		// Reverse 8-bit integers in each 64-bit lane
-		// Reverse the 64-bit lanes
-		Lower = vrev64q_u8( Lower );
-		Lower = vextq_u8( Lower, Lower, 8 );
-
-		Upper = vrev64q_u8(Upper);
-		Upper = vextq_u8( Upper, Upper, 8 );
-
-		// Place them at their swapped position
-		vst1q_u8(
-			&Array8[i],
-			Upper
-		);
-		vst1q_u8(
-			&Array8[Count - i - 16],
-			Lower
-		);
-
-		// 16 elements at a time
-		i += 16;
-	}
-#endif
-	// BSWAP 64
-	for( std::size_t j = i / 8; j < ((Count / 2) / 8); ++j )
-	{
-		// Get bswapped versions of our Upper and Lower 8-byte chunks
-		std::uint64_t Lower = Swap64(
-			*reinterpret_cast<std::uint64_t*>(&Array8[i])
-		);
-		std::uint64_t Upper = Swap64(
-			*reinterpret_cast<std::uint64_t*>(&Array8[Count - i - 8])
-		);
-
-		// Place them at their swapped position
-		*reinterpret_cast<std::uint64_t*>(&Array8[i]) = Upper;
-		*reinterpret_cast<std::uint64_t*>(&Array8[Count - i - 8]) = Lower;
-
-		// Eight elements at a time
-		i += 8;
-	}
-	// BSWAP 32
-	for( std::size_t j = i / 4; j < ((Count / 2) / 4); ++j )
-	{
-		// Get bswapped versions of our Upper and Lower 4-byte chunks
-		std::uint32_t Lower = Swap32(
-			*reinterpret_cast<std::uint32_t*>(&Array8[i])
-		);
-		std::uint32_t Upper = Swap32(
-			*reinterpret_cast<std::uint32_t*>(&Array8[Count - i - 4])
-		);
-
-		// Place them at their swapped position
-		*reinterpret_cast<std::uint32_t*>(&Array8[i]) = Upper;
-		*reinterpret_cast<std::uint32_t*>(&Array8[Count - i - 4]) = Lower;
-
-		// Four elements at a time
-		i += 4;
-	}
-	// BSWAP 16
-	for( std::size_t j = i / 2; j < ((Count / 2) / 2); ++j )
-	{
-		// Get bswapped versions of our Upper and Lower 4-byte chunks
-		std::uint16_t Lower = Swap16(
-			*reinterpret_cast<std::uint16_t*>(&Array8[i])
-		);
-		std::uint16_t Upper = Swap16(
-			*reinterpret_cast<std::uint16_t*>(&Array8[Count - i - 2])
-		);
-
-		// Place them at their swapped position
-		*reinterpret_cast<std::uint16_t*>(&Array8[i]) = Upper;
-		*reinterpret_cast<std::uint16_t*>(&Array8[Count - i - 2]) = Lower;
-
-		// Two elements at a time
-		i += 2;
-	}
-
-	// Everything else that we can not do a bswap on, we swap normally
-	// Naive swaps
-	for( ; i < Count / 2; ++i )
-	{
-		// Exchange the upper and lower element as we work our
-		// way down to the middle from either end
-		std::uint8_t Temp(Array8[i]);
-		Array8[i] = Array8[Count - i - 1];
-		Array8[Count - i - 1] = Temp;
-	}
-}
-
-
-// Two byte elements
-template<>
-inline void qReverse<2>(void* Array, std::size_t Count)
-{
-	std::uint16_t* Array16 = reinterpret_cast<std::uint16_t*>(Array);
-	std::size_t i = 0;
-	// AVX-512BW/F
-#if defined(__AVX512F__) && defined(__AVX512BW__)
-	for( std::size_t j = i / 32; j < ((Count / 2) / 32); ++j )
-	{
-		const __m512i ShuffleRev = _mm512_set_epi64(
-			0x00000100020003,
-			0x04000500060007,
-			0x080009000a000b,
-			0x0c000d000e000f,
-			0x10001100120013,
-			0x14001500160017,
-			0x180019001a001b,
-			0x1c001d001e001f
-		);
-
-		// Load 32 elements at once into one 64-byte register
-		__m512i Lower = _mm512_loadu_si512(
-			reinterpret_cast<__m512i*>(&Array16[i])
-		);
-		__m512i Upper = _mm512_loadu_si512(
-			reinterpret_cast<__m512i*>(&Array16[Count - i - 32])
-		);
-
-		// Reverse the byte order of each 128-bit lane
-		Lower = _mm512_permutexvar_epi16(ShuffleRev, Lower);
-		Upper = _mm512_permutexvar_epi16(ShuffleRev, Upper);
-
-		// Place them at their swapped position
-		_mm512_storeu_si512(
-			reinterpret_cast<__m512i*>(&Array16[i]),
-			Upper
-		);
-		_mm512_storeu_si512(
-			reinterpret_cast<__m512i*>(&Array16[Count - i - 32]),
-			Lower
-		);
-
-		// 32 elements at a time
-		i += 32;
-	}
-#endif
-	// AVX-2
-#if defined(__AVX2__)
-	for( std::size_t j = i / 16; j < ((Count / 2) / 16); ++j )
-	{
-		const __m256i ShuffleRev = _mm256_set_epi8(
-			1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
-			1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
-		);
-		// Load 16 elements at once into one 32-byte register
-		__m256i Lower = _mm256_loadu_si256(
-			reinterpret_cast<__m256i*>(&Array16[i])
-		);
-		__m256i Upper = _mm256_loadu_si256(
-			reinterpret_cast<__m256i*>(&Array16[Count - i - 16])
-		);
-
-		Lower = _mm256_shuffle_epi8(Lower,ShuffleRev);
-		Upper = _mm256_shuffle_epi8(Upper,ShuffleRev);
-
-		Lower = _mm256_permute2x128_si256(Lower,Lower,1);
-		Upper = _mm256_permute2x128_si256(Upper,Upper,1);
-
-		// Place them at their swapped position
-		_mm256_storeu_si256(
-			reinterpret_cast<__m256i*>(&Array16[i]),
-			Upper
-		);
-		_mm256_storeu_si256(
-			reinterpret_cast<__m256i*>(&Array16[Count - i - 16]),
-			Lower
-		);
-
-		// 32 elements at a time
-		i += 16;
-	}
-#endif
-	// SSSE3
-#if defined(__SSSE3__)
-	for( std::size_t j = i / 8; j < ((Count / 2) / 8); ++j )
-	{
-		const __m128i ShuffleRev = _mm_set_epi8(
-			1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
-		);
-		// Load 8 elements at once into one 16-byte register
-		__m128i Lower = _mm_loadu_si128(
-			reinterpret_cast<__m128i*>(&Array16[i])
-		);
-		__m128i Upper = _mm_loadu_si128(
-			reinterpret_cast<__m128i*>(&Array16[Count - i - 8])
-		);
-
-		Lower = _mm_shuffle_epi8(Lower, ShuffleRev);
-		Upper = _mm_shuffle_epi8(Upper, ShuffleRev);
-
-		// Place them at their swapped position
-		_mm_storeu_si128(
-			reinterpret_cast<__m128i*>(&Array16[i]),
-			Upper
-		);
-		_mm_storeu_si128(
-			reinterpret_cast<__m128i*>(&Array16[Count - i - 8]),
-			Lower
-		);
-
-		// 8 elements at a time
-		i += 8;
-	}
-#endif
-	// NEON
-#if defined(__ARM_NEON)
-	for( std::size_t j = i / 8; j < ((Count / 2) / 8); ++j )
-	{
-		// Load 8 elements at once into one 16-byte register
-		uint16x8_t Lower = vld1q_u16( &Array16[i] );
-		uint16x8_t Upper = vld1q_u16( &Array16[Count - i - 8] );
-
-		// Reverse 16-bit integers in each 64-bit lane
-		// Reverse the 64-bit lanes
-		Lower = vrev64q_u16( Lower );
-		Lower = vextq_u16( Lower, Lower, 4 );
-
-		Upper = vrev64q_u16(Upper);
-		Upper = vextq_u16( Upper, Upper, 4 );
-
-		// Place them at their swapped position
-		vst1q_u16(
-			&Array16[i],
-			Upper
-		);
-		vst1q_u16(
-			&Array16[Count - i - 8],
-			Lower
-		);
-
-		// 8 elements at a time
-		i += 8;
-	}
-#endif
-
-	// Naive swaps
-	for( ; i < Count / 2; ++i )
-	{
-		// Exchange the upper and lower element as we work our
-		// way down to the middle from either end
-		std::uint16_t Temp(Array16[i]);
-		Array16[i] = Array16[Count - i - 1];
-		Array16[Count - i - 1] = Temp;
-	}
-}
-
-// Four byte elements
-template<>
-inline void qReverse<4>(void* Array, std::size_t Count)
-{
-	std::uint32_t* Array32 = reinterpret_cast<std::uint32_t*>(Array);
-	std::size_t i = 0;
-
-	// AVX-512BW/F
-#if defined(__AVX512F__) && defined(__AVX512BW__)
-	for( std::size_t j = i / 16; j < ((Count / 2) / 16); ++j )
-	{
-		const __m512i ShuffleRev = _mm512_set_epi32(
-			0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
-		);
-
-		// Load 16 elements at once into one 64-byte register
-		__m512i Lower = _mm512_loadu_si512(
-			reinterpret_cast<__m512i*>(&Array32[i])
-		);
-		__m512i Upper = _mm512_loadu_si512(
-			reinterpret_cast<__m512i*>(&Array32[Count - i - 16])
-		);
-
-		// Reverse the byte order of each 128-bit lane
-		Lower = _mm512_permutexvar_epi32(ShuffleRev, Lower);
-		Upper = _mm512_permutexvar_epi32(ShuffleRev, Upper);
-
-		// Place them at their swapped position
-		_mm512_storeu_si512(
-			reinterpret_cast<__m512i*>(&Array32[i]),
-			Upper
-		);
-		_mm512_storeu_si512(
-			reinterpret_cast<__m512i*>(&Array32[Count - i - 16]),
-			Lower
-		);
-
-		// 16 elements at a time
-		i += 16;
-	}
-#endif
-	// AVX-2
-#if defined(__AVX2__)
-	for( std::size_t j = i / 8; j < ((Count / 2) / 8); ++j )
-	{
-		// Load 8 elements at once into one 32-byte register
-		__m256i Lower = _mm256_loadu_si256(
-			reinterpret_cast<__m256i*>(&Array32[i])
-		);
-		__m256i Upper = _mm256_loadu_si256(
-			reinterpret_cast<__m256i*>(&Array32[Count - i - 8])
-		);
-
-		Lower = _mm256_shuffle_epi32(Lower, _MM_SHUFFLE(0,1,2,3) );
-		Upper = _mm256_shuffle_epi32(Upper, _MM_SHUFFLE(0,1,2,3) );
-
-		Lower = _mm256_permute2x128_si256(Lower,Lower,1);
-		Upper = _mm256_permute2x128_si256(Upper,Upper,1);
-
-		// Place them at their swapped position
-		_mm256_storeu_si256(
-			reinterpret_cast<__m256i*>(&Array32[i]),
-			Upper
-		);
-		_mm256_storeu_si256(
-			reinterpret_cast<__m256i*>(&Array32[Count - i - 8]),
-			Lower
-		);
-
-		// 8 elements at a time
-		i += 8;
-	}
-#endif
-	// SSSE3
-#if defined(__SSSE3__)
-	for( std::size_t j = i / 4; j < ((Count / 2) / 4); ++j )
-	{
-		// Load 4 elements at once into one 16-byte register
-		__m128i Lower = _mm_loadu_si128(
-			reinterpret_cast<__m128i*>(&Array32[i])
-		);
-		__m128i Upper = _mm_loadu_si128(
-			reinterpret_cast<__m128i*>(&Array32[Count - i - 4])
-		);
-
-		Lower = _mm_shuffle_epi32(Lower, _MM_SHUFFLE(0,1,2,3) );
-		Upper = _mm_shuffle_epi32(Upper, _MM_SHUFFLE(0,1,2,3) );
-
-		// Place them at their swapped position
-		_mm_storeu_si128(
-			reinterpret_cast<__m128i*>(&Array32[i]),
-			Upper
-		);
-		_mm_storeu_si128(
-			reinterpret_cast<__m128i*>(&Array32[Count - i - 4]),
-			Lower
-		);
-
-		// 4 elements at a time
-		i += 4;
-	}
-#endif
-	// NEON
-#if defined(__ARM_NEON)
-	for( std::size_t j = i / 4; j < ((Count / 2) / 4); ++j )
-	{
-		// Load 4 elements at once into one 4-byte register
-		uint32x4_t Lower = vld1q_u32( &Array32[i] );
-		uint32x4_t Upper = vld1q_u32( &Array32[Count - i - 4] );
-
-		// Reverse 32-bit integers in each 64-bit lane
-		// Reverse the 64-bit lanes
-		Lower = vrev64q_u32( Lower );
-		Lower = vextq_u32( Lower, Lower, 2 );
-
-		Upper = vrev64q_u32(Upper);
-		Upper = vextq_u32( Upper, Upper, 2 );
-
-		// Place them at their swapped position
-		vst1q_u32(
-			&Array32[i],
-			Upper
-		);
-		vst1q_u32(
-			&Array32[Count - i - 4],
-			Lower
-		);
-
-		// 4 elements at a time
-		i += 4;
-	}
-#endif
-	// Naive swaps
-	for( ; i < Count / 2; ++i )
-	{
-		// Exchange the upper and lower element as we work our
-		// way down to the middle from either end
-		std::uint32_t Temp(Array32[i]);
-		Array32[i] = Array32[Count - i - 1];
-		Array32[Count - i - 1] = Temp;
-	}
-}
-
-// 8 byte elements
-template<>
-inline void qReverse<8>(void* Array, std::size_t Count)
-{
-	std::uint64_t* Array64 = reinterpret_cast<std::uint64_t*>(Array);
-	std::size_t i = 0;
-
-	// AVX-512BW/F
-#if defined(__AVX512F__) && defined(__AVX512BW__)
-	for( std::size_t j = i / 8; j < ((Count / 2) / 8); ++j )
-	{
-		const __m512i ShuffleRev = _mm512_set_epi64(
-			0, 1, 2, 3, 4, 5, 6, 7
-		);
-
-		// Load 8 elements at once into one 64-byte register
-		__m512i Lower = _mm512_loadu_si512(
-			reinterpret_cast<__m512i*>(&Array64[i])
-		);
-		__m512i Upper = _mm512_loadu_si512(
-			reinterpret_cast<__m512i*>(&Array64[Count - i - 8])
-		);
-
-		// Reverse the byte order of each 128-bit lane
-		Lower = _mm512_permutexvar_epi64(ShuffleRev, Lower);
-		Upper = _mm512_permutexvar_epi64(ShuffleRev, Upper);
-
-		// Place them at their swapped position
-		_mm512_storeu_si512(
-			reinterpret_cast<__m512i*>(&Array64[i]),
-			Upper
-		);
-		_mm512_storeu_si512(
-			reinterpret_cast<__m512i*>(&Array64[Count - i - 8]),
-			Lower
-		);
-
-		// 8 elements at a time
-		i += 8;
-	}
-#endif
-	// AVX-2
-#if defined(__AVX2__)
-	for( std::size_t j = i / 4; j < ((Count / 2) / 4); ++j )
-	{
-		// Load 4 elements at once into one 32-byte register
-		__m256i Lower = _mm256_loadu_si256(
-			reinterpret_cast<__m256i*>(&Array64[i])
-		);
-		__m256i Upper = _mm256_loadu_si256(
-			reinterpret_cast<__m256i*>(&Array64[Count - i - 4])
-		);
-
-		Lower = _mm256_alignr_epi8(Lower, Lower, 8);
-		Upper = _mm256_alignr_epi8(Upper, Upper, 8);
-
-		Lower = _mm256_permute2x128_si256(Lower,Lower,1);
-		Upper = _mm256_permute2x128_si256(Upper,Upper,1);
-
-		// Place them at their swapped position
-		_mm256_storeu_si256(
-			reinterpret_cast<__m256i*>(&Array64[i]),
-			Upper
-		);
-		_mm256_storeu_si256(
-			reinterpret_cast<__m256i*>(&Array64[Count - i - 4]),
-			Lower
-		);
-
-		// 4 elements at a time
-		i += 4;
-	}
-#endif
-	// SSSE3
-#if defined(__SSSE3__)
-	for( std::size_t j = i / 2; j < ((Count / 2) / 2); ++j )
-	{
-		// Load 2 elements at once into one 16-byte register
-		__m128i Lower = _mm_loadu_si128(
-			reinterpret_cast<__m128i*>(&Array64[i])
-		);
-		__m128i Upper = _mm_loadu_si128(
-			reinterpret_cast<__m128i*>(&Array64[Count - i - 2])
-		);
-
-		Lower = _mm_alignr_epi8(Lower, Lower, 8);
-		Upper = _mm_alignr_epi8(Upper, Upper, 8);
-
-		// Place them at their swapped position
-		_mm_storeu_si128(
-			reinterpret_cast<__m128i*>(&Array64[i]),
-			Upper
-		);
-		_mm_storeu_si128(
-			reinterpret_cast<__m128i*>(&Array64[Count - i - 2]),
-			Lower
-		);
-
-		// 2 elements at a time
-		i += 2;
-	}
-#endif
-	// NEON
-#if defined(__ARM_NEON)
-	for( std::size_t j = i / 2; j < ((Count / 2) / 2); ++j )
-	{
-		// Load 2 elements at once into one 2-byte register
-		uint64x2_t Lower = vld1q_u64( &Array64[i] );
-		uint64x2_t Upper = vld1q_u64( &Array64[Count - i - 2] );
-
-		// Reverse the 64-bit lanes
-		Lower = vextq_u64( Lower, Lower, 1 );
-		Upper = vextq_u64( Upper, Upper, 1 );
-
-		// Place them at their swapped position
-		vst1q_u64(
-			&Array64[i],
-			Upper
-		);
-		vst1q_u64(
-			&Array64[Count - i - 2],
-			Lower
-		);
-
-		// 2 elements at a time
-		i += 2;
-	}
-#endif
-
-	// Naive swaps
-	for( ; i < Count / 2; ++i )
-	{
-		// Exchange the upper and lower element as we work our
-		// way down to the middle from either end
-		std::uint64_t Temp(Array64[i]);
-		Array64[i] = Array64[Count - i - 1];
-		Array64[Count - i - 1] = Temp;
-	}
-}
-
-// 16 byte elements
-template<>
-inline void qReverse<16>(void* Array, std::size_t Count)
-{
-	struct uint128_t
-	{
-		std::uint64_t u64[2];
-	};
-	uint128_t* Array128 = reinterpret_cast<uint128_t*>(Array);
-	std::size_t i = 0;
-
-	// AVX-512BW/F
-#if defined(__AVX512F__) && defined(__AVX512BW__)
-	for( std::size_t j = i / 4; j < ((Count / 2) / 4); ++j )
-	{
-		const __m512i ShuffleRev = _mm512_set_epi64(
-			1, 0, 3, 2, 5, 4, 7, 6
-		);
-		// Load 4 elements at once into one 64-byte register
-		__m512i Lower = _mm512_loadu_si512(
-			reinterpret_cast<__m512i*>(&Array128[i])
-		);
-		__m512i Upper = _mm512_loadu_si512(
-			reinterpret_cast<__m512i*>(&Array128[Count - i - 4])
-		);
-
-		// Reverse the byte order of each 128-bit lane
-		Lower = _mm512_permutexvar_epi64( ShuffleRev, Lower );
-		Upper = _mm512_permutexvar_epi64( ShuffleRev, Upper );
-
-		// Place them at their swapped position
-		_mm512_storeu_si512(
-			reinterpret_cast<__m512i*>(&Array128[i]),
-			Upper
-		);
-		_mm512_storeu_si512(
-			reinterpret_cast<__m512i*>(&Array128[Count - i - 4]),
-			Lower
-		);
-
-		// 4 elements at a time
-		i += 4;
-	}
-#endif
-
-	// AVX-2
-#if defined(__AVX2__)
-	for( std::size_t j = i / 2; j < ((Count / 2) / 2); ++j )
-	{
-		// Load 2 elements at once into one 32-byte register
-		__m256i Lower = _mm256_loadu_si256(
-			reinterpret_cast<__m256i*>(&Array128[i])
-		);
-		__m256i Upper = _mm256_loadu_si256(
-			reinterpret_cast<__m256i*>(&Array128[Count - i - 2])
-		);
-
-		Lower = _mm256_permute4x64_epi64( Lower, _MM_SHUFFLE(0,1,2,3) );
-		Upper = _mm256_permute4x64_epi64( Upper, _MM_SHUFFLE(0,1,2,3) );
-
-		// Place them at their swapped position
-		_mm256_storeu_si256(
-			reinterpret_cast<__m256i*>(&Array128[i]),
-			Upper
-		);
-		_mm256_storeu_si256(
-			reinterpret_cast<__m256i*>(&Array128[Count - i - 2]),
-			Lower
-		);
-
-		// 2 elements at a time
-		i += 2;
-	}
-#endif
-
-	// Naive swaps
-	for( ; i < Count / 2; ++i )
-	{
-		// Exchange the upper and lower element as we work our
-		// way down to the middle from either end
-		uint128_t Temp(Array128[i]);
-		Array128[i] = Array128[Count - i - 1];
-		Array128[Count - i - 1] = Temp;
-	}
-}
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#if defined(QREVERSE_STATS)
+#include <atomic>
+#include <chrono>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+// x86
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+	#define QREVERSE_X86
+
+	#if defined(_MSC_VER)
+	
+	#include <intrin.h>
+	
+	inline std::uint64_t Swap64(std::uint64_t x)
+	{
+		return _byteswap_uint64(x);
+	}
+	
+	inline std::uint32_t Swap32(std::uint32_t x)
+	{
+		return _byteswap_ulong(x);
+	}
+	
+	inline std::uint16_t Swap16(std::uint16_t x)
+	{
+		return _byteswap_ushort(x);
+	}
+	
+	#elif defined(__GNUC__) || defined(__clang__)
+	
+	#include <x86intrin.h>
+	
+	inline std::uint64_t Swap64(std::uint64_t x)
+	{
+		return __builtin_bswap64(x);
+	}
+	
+	inline std::uint32_t Swap32(std::uint32_t x)
+	{
+		return __builtin_bswap32(x);
+	}
+	
+	inline std::uint16_t Swap16(std::uint16_t x)
+	{
+		return __builtin_bswap16(x);
+	}
+
+	#endif
+
+// ARM
+#elif defined(__ARM_NEON)
+	#define QREVERSE_NEON
+
+	#include <arm_neon.h>
+
+	// SVE intrinsics are only available when the compiler already targets it,
+	// such as with -march=armv8-a+sve or QREVERSE_NATIVE on an SVE host
+	#if defined(__ARM_FEATURE_SVE)
+	#define QREVERSE_SVE
+
+	#include <arm_sve.h>
+
+	#if defined(__linux__)
+	#include <sys/auxv.h>
+	#endif
+	#endif
+
+	#if defined(_MSC_VER)
+	
+	inline std::uint64_t Swap64(std::uint64_t x)
+	{
+		return _byteswap_uint64(x);
+	}
+	
+	inline std::uint32_t Swap32(std::uint32_t x)
+	{
+		return _byteswap_ulong(x);
+	}
+	
+	inline std::uint16_t Swap16(std::uint16_t x)
+	{
+		return _byteswap_ushort(x);
+	}
+	
+	#elif defined(__GNUC__) || defined(__clang__)
+	
+	inline std::uint64_t Swap64(std::uint64_t x)
+	{
+		return __builtin_bswap64(x);
+	}
+	
+	inline std::uint32_t Swap32(std::uint32_t x)
+	{
+		return __builtin_bswap32(x);
+	}
+	
+	inline std::uint16_t Swap16(std::uint16_t x)
+	{
+		return __builtin_bswap16(x);
+	}
+
+	#endif
+
+// Pure
+#else
+
+inline std::uint64_t Swap64(std::uint64_t x)
+{
+	return (
+		((x & 0x00000000000000FF) << 56) |
+		((x & 0x000000000000FF00) << 40) |
+		((x & 0x0000000000FF0000) << 24) |
+		((x & 0x00000000FF000000) <<  8) |
+		((x & 0x000000FF00000000) >>  8) |
+		((x & 0x0000FF0000000000) >> 24) |
+		((x & 0x00FF000000000000) >> 40) |
+		((x & 0xFF00000000000000) >> 56)
+	);
+}
+
+inline std::uint32_t Swap32(std::uint32_t x)
+{
+	return(
+		((x & 0x000000FF) << 24) |
+		((x & 0x0000FF00) <<  8) |
+		((x & 0x00FF0000) >>  8) |
+		((x & 0xFF000000) >> 24)
+	);
+}
+
+inline std::uint16_t Swap16(std::uint16_t x)
+{
+	return (
+		((x & 0x00FF) << 8) |
+		((x & 0xFF00) >> 8)
+	);
+}
+
+#endif
+
+
+// Kernels are compiled for each instruction set through target attributes
+// rather than through -march so that a single build may carry all of them
+// and pick the fastest one that the running processor supports
+#if defined(__GNUC__) || defined(__clang__)
+	#define QREVERSE_TARGET(Features) __attribute__((target(Features)))
+#else
+	#define QREVERSE_TARGET(Features)
+#endif
+
+#define QREVERSE_TARGET_SSSE3  QREVERSE_TARGET("ssse3")
+#define QREVERSE_TARGET_AVX2   QREVERSE_TARGET("avx2")
+#define QREVERSE_TARGET_AVX512 QREVERSE_TARGET("avx512f,avx512bw")
+#define QREVERSE_TARGET_AVX512VBMI \
+	QREVERSE_TARGET("avx512f,avx512bw,avx512vbmi")
+
+namespace qreverse
+{
+
+// Implementations available to qReverse, from the most serial to the most
+// parallel. Each tier handles as much of the array as it can before handing
+// the remainder down to the tiers beneath it.
+enum class Tier : std::uint8_t
+{
+	Serial = 0, // Element-by-element swaps
+	Swap,       // bswap/rev
+	SSSE3,
+	NEON,
+	AVX2,
+	AVX512,     // AVX-512F and AVX-512BW
+	AVX512VBMI, // AVX-512 with VBMI byte permutes
+	SVE,        // Vector-length agnostic ARM SVE
+	Count
+};
+
+// Which ends of the array a kernel's widest step runs over with aligned loads
+// and stores after peeling off enough elements to align the lower end
+enum class Alignment : std::uint8_t
+{
+	None = 0, // Neither end, the lower end could not be aligned
+	Lower,    // Only the lower end
+	Both,     // Both the lower and upper end
+};
+
+// Exchanges each element i within [Begin, End) with its mirrored element at
+// Count - i - 1. Reversing a whole array is the range [0, Count / 2).
+using ReverseProc = void(*)(
+	void* Array, std::size_t Count, std::size_t Begin, std::size_t End
+);
+using ReverseCopyProc = void(*)(const void* Src, void* Dst, std::size_t Count);
+using ByteswapProc = void(*)(void* Array, std::size_t Count);
+
+namespace detail
+{
+
+// Probes the running processor and returns a bitmask of the usable tiers
+inline std::uint32_t ProbeTiers()
+{
+	std::uint32_t Tiers =
+		(1u << static_cast<std::uint32_t>(Tier::Serial)) |
+		(1u << static_cast<std::uint32_t>(Tier::Swap));
+#if defined(QREVERSE_X86)
+	#if defined(_MSC_VER)
+	int Info[4];
+	__cpuid(Info, 0);
+	const int MaxLeaf = Info[0];
+
+	__cpuid(Info, 1);
+	const bool SSSE3 = (Info[2] & (1 << 9)) != 0;
+	const bool OSXSAVE = (Info[2] & (1 << 27)) != 0;
+	// The OS must also save the upper ymm/zmm registers across context
+	// switches for the wider tiers to be usable
+	const std::uint64_t XCR0 = OSXSAVE ? _xgetbv(0) : 0;
+
+	bool AVX2 = false;
+	bool AVX512 = false;
+	bool AVX512VBMI = false;
+	if( MaxLeaf >= 7 )
+	{
+		__cpuidex(Info, 7, 0);
+		AVX2 = (Info[1] & (1 << 5)) && ((XCR0 & 0x06) == 0x06);
+		AVX512 = (Info[1] & (1 << 16)) && (Info[1] & (1 << 30))
+			&& ((XCR0 & 0xE6) == 0xE6);
+		AVX512VBMI = AVX512 && (Info[2] & (1 << 1));
+	}
+	#else
+	__builtin_cpu_init();
+	const bool SSSE3 = __builtin_cpu_supports("ssse3");
+	const bool AVX2 = __builtin_cpu_supports("avx2");
+	const bool AVX512 = __builtin_cpu_supports("avx512f")
+		&& __builtin_cpu_supports("avx512bw");
+	const bool AVX512VBMI = AVX512 && __builtin_cpu_supports("avx512vbmi");
+	#endif
+	if( SSSE3 )  Tiers |= 1u << static_cast<std::uint32_t>(Tier::SSSE3);
+	if( AVX2 )   Tiers |= 1u << static_cast<std::uint32_t>(Tier::AVX2);
+	if( AVX512 ) Tiers |= 1u << static_cast<std::uint32_t>(Tier::AVX512);
+	if( AVX512VBMI )
+	{
+		Tiers |= 1u << static_cast<std::uint32_t>(Tier::AVX512VBMI);
+	}
+#elif defined(QREVERSE_NEON)
+	Tiers |= 1u << static_cast<std::uint32_t>(Tier::NEON);
+	#if defined(QREVERSE_SVE)
+	#if defined(__linux__)
+	#if !defined(HWCAP_SVE)
+	#define HWCAP_SVE (1 << 22)
+	#endif
+	if( getauxval(AT_HWCAP) & HWCAP_SVE )
+	{
+		Tiers |= 1u << static_cast<std::uint32_t>(Tier::SVE);
+	}
+	#else
+	// Built for SVE without a way to ask, so it is taken to be present
+	Tiers |= 1u << static_cast<std::uint32_t>(Tier::SVE);
+	#endif
+	#endif
+#endif
+	return Tiers;
+}
+
+// Size in bytes of the last-level cache, used to decide when a destination
+// is large enough that caching it would only evict the working set
+inline std::size_t LastLevelCacheSize()
+{
+	static const std::size_t CacheSize = []() -> std::size_t
+	{
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+		const long Size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+		if( Size > 0 )
+		{
+			return static_cast<std::size_t>(Size);
+		}
+#endif
+		// Assume a typical desktop-class cache when it can't be queried
+		return 8u * 1024u * 1024u;
+	}();
+	return CacheSize;
+}
+
+// Reverse-copies of at least this many bytes stream their stores past the
+// cache, by default those larger than the last-level cache
+#if !defined(QREVERSE_STREAM_THRESHOLD)
+#define QREVERSE_STREAM_THRESHOLD LastLevelCacheSize()
+#endif
+
+inline std::size_t StreamThreshold()
+{
+	return QREVERSE_STREAM_THRESHOLD;
+}
+
+/// Register permutations
+// Reverses the order of the ElementSize-byte elements held within a single
+// vector register. Element sizes without a permutation for a tier leave its
+// flag unset and the tier's steps fall through for them.
+
+template< std::size_t ElementSize >
+struct RegisterReverse
+{
+	static constexpr bool SSSE3  = false;
+	static constexpr bool AVX2   = false;
+	static constexpr bool AVX512 = false;
+	static constexpr bool NEON   = false;
+	static constexpr bool SVE    = false;
+
+#if defined(QREVERSE_X86)
+	QREVERSE_TARGET_SSSE3
+	static inline __m128i Reverse128(__m128i Vector) { return Vector; }
+
+	QREVERSE_TARGET_AVX2
+	static inline __m256i Reverse256(__m256i Vector) { return Vector; }
+
+	QREVERSE_TARGET_AVX512
+	static inline __m512i Reverse512(__m512i Vector) { return Vector; }
+#endif
+
+#if defined(QREVERSE_NEON)
+	static inline uint8x16_t ReverseNEON(uint8x16_t Vector) { return Vector; }
+#endif
+
+#if defined(QREVERSE_SVE)
+	static inline svuint8_t ReverseSVE(svuint8_t Vector) { return Vector; }
+#endif
+};
+
+// One byte elements
+template<>
+struct RegisterReverse<1>
+{
+	static constexpr bool SSSE3  = true;
+	static constexpr bool AVX2   = true;
+	static constexpr bool AVX512 = true;
+	static constexpr bool NEON   = true;
+	static constexpr bool SVE    = true;
+
+#if defined(QREVERSE_X86)
+	QREVERSE_TARGET_SSSE3
+	static inline __m128i Reverse128(__m128i Vector)
+	{
+		const __m128i ShuffleRev = _mm_set_epi8(
+			0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
+		);
+		// Reverse the byte order of our 16-byte vector
+		return _mm_shuffle_epi8(Vector, ShuffleRev);
+	}
+
+	QREVERSE_TARGET_AVX2
+	static inline __m256i Reverse256(__m256i Vector)
+	{
+		const __m256i ShuffleRev = _mm256_set_epi8(
+			0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15,
+			0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15
+		);
+		// Reverse the byte order of each 128-bit lane
+		Vector = _mm256_shuffle_epi8(Vector, ShuffleRev);
+		// Swap the two 128-bit lanes
+		return _mm256_permute2x128_si256(Vector, Vector, 1);
+	}
+
+	QREVERSE_TARGET_AVX512
+	static inline __m512i Reverse512(__m512i Vector)
+	{
+		// Reverses the 16 bytes of the four  128-bit lanes in a 512-bit register
+		const __m512i ShuffleRev8 = _mm512_set_epi32(
+			0x00010203, 0x4050607, 0x8090a0b, 0xc0d0e0f,
+			0x00010203, 0x4050607, 0x8090a0b, 0xc0d0e0f,
+			0x00010203, 0x4050607, 0x8090a0b, 0xc0d0e0f,
+			0x00010203, 0x4050607, 0x8090a0b, 0xc0d0e0f
+		);
+
+		// Reverses the four 128-bit lanes of a 512-bit register
+		const __m512i ShuffleRev64 = _mm512_set_epi64(
+			1,0,3,2,5,4,7,6
+		);
+
+		// Reverse the byte order of each 128-bit lane
+		Vector = _mm512_shuffle_epi8(Vector, ShuffleRev8);
+		// Reverse the four 128-bit lanes in the 512-bit register
+		return _mm512_permutexvar_epi64(ShuffleRev64, Vector);
+	}
+#endif
+
+#if defined(QREVERSE_NEON)
+	static inline uint8x16_t ReverseNEON(uint8x16_t Vector)
+	{
+		// Reverse 8-bit integers in each 64-bit lane
+		// Reverse the 64-bit lanes
+		Vector = vrev64q_u8( Vector );
+		return vextq_u8( Vector, Vector, 8 );
+	}
+#endif
+
+#if defined(QREVERSE_SVE)
+	static inline svuint8_t ReverseSVE(svuint8_t Vector)
+	{
+		return svrev_u8(Vector);
+	}
+#endif
+};
+
+// Two byte elements
+template<>
+struct RegisterReverse<2>
+{
+	static constexpr bool SSSE3  = true;
+	static constexpr bool AVX2   = true;
+	static constexpr bool AVX512 = true;
+	static constexpr bool NEON   = true;
+	static constexpr bool SVE    = true;
+
+#if defined(QREVERSE_X86)
+	QREVERSE_TARGET_SSSE3
+	static inline __m128i Reverse128(__m128i Vector)
+	{
+		const __m128i ShuffleRev = _mm_set_epi8(
+			1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
+		);
+		return _mm_shuffle_epi8(Vector, ShuffleRev);
+	}
+
+	QREVERSE_TARGET_AVX2
+	static inline __m256i Reverse256(__m256i Vector)
+	{
+		const __m256i ShuffleRev = _mm256_set_epi8(
+			1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+			1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
+		);
+		Vector = _mm256_shuffle_epi8(Vector, ShuffleRev);
+		return _mm256_permute2x128_si256(Vector, Vector, 1);
+	}
+
+	QREVERSE_TARGET_AVX512
+	static inline __m512i Reverse512(__m512i Vector)
+	{
+		const __m512i ShuffleRev = _mm512_set_epi64(
+			0x00000100020003,
+			0x04000500060007,
+			0x080009000a000b,
+			0x0c000d000e000f,
+			0x10001100120013,
+			0x14001500160017,
+			0x180019001a001b,
+			0x1c001d001e001f
+		);
+		return _mm512_permutexvar_epi16(ShuffleRev, Vector);
+	}
+#endif
+
+#if defined(QREVERSE_NEON)
+	static inline uint8x16_t ReverseNEON(uint8x16_t Vector)
+	{
+		// Reverse 16-bit integers in each 64-bit lane
+		// Reverse the 64-bit lanes
+		uint16x8_t Vector16 = vrev64q_u16( vreinterpretq_u16_u8(Vector) );
+		Vector16 = vextq_u16( Vector16, Vector16, 4 );
+		return vreinterpretq_u8_u16(Vector16);
+	}
+#endif
+
+#if defined(QREVERSE_SVE)
+	static inline svuint8_t ReverseSVE(svuint8_t Vector)
+	{
+		return svreinterpret_u8_u16(
+			svrev_u16(svreinterpret_u16_u8(Vector))
+		);
+	}
+#endif
+};
+
+// Four byte elements
+template<>
+struct RegisterReverse<4>
+{
+	static constexpr bool SSSE3  = true;
+	static constexpr bool AVX2   = true;
+	static constexpr bool AVX512 = true;
+	static constexpr bool NEON   = true;
+	static constexpr bool SVE    = true;
+
+#if defined(QREVERSE_X86)
+	QREVERSE_TARGET_SSSE3
+	static inline __m128i Reverse128(__m128i Vector)
+	{
+		return _mm_shuffle_epi32(Vector, _MM_SHUFFLE(0,1,2,3) );
+	}
+
+	QREVERSE_TARGET_AVX2
+	static inline __m256i Reverse256(__m256i Vector)
+	{
+		Vector = _mm256_shuffle_epi32(Vector, _MM_SHUFFLE(0,1,2,3) );
+		return _mm256_permute2x128_si256(Vector, Vector, 1);
+	}
+
+	QREVERSE_TARGET_AVX512
+	static inline __m512i Reverse512(__m512i Vector)
+	{
+		const __m512i ShuffleRev = _mm512_set_epi32(
+			0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
+		);
+		return _mm512_permutexvar_epi32(ShuffleRev, Vector);
+	}
+#endif
+
+#if defined(QREVERSE_NEON)
+	static inline uint8x16_t ReverseNEON(uint8x16_t Vector)
+	{
+		// Reverse 32-bit integers in each 64-bit lane
+		// Reverse the 64-bit lanes
+		uint32x4_t Vector32 = vrev64q_u32( vreinterpretq_u32_u8(Vector) );
+		Vector32 = vextq_u32( Vector32, Vector32, 2 );
+		return vreinterpretq_u8_u32(Vector32);
+	}
+#endif
+
+#if defined(QREVERSE_SVE)
+	static inline svuint8_t ReverseSVE(svuint8_t Vector)
+	{
+		return svreinterpret_u8_u32(
+			svrev_u32(svreinterpret_u32_u8(Vector))
+		);
+	}
+#endif
+};
+
+// 8 byte elements
+template<>
+struct RegisterReverse<8>
+{
+	static constexpr bool SSSE3  = true;
+	static constexpr bool AVX2   = true;
+	static constexpr bool AVX512 = true;
+	static constexpr bool NEON   = true;
+	static constexpr bool SVE    = true;
+
+#if defined(QREVERSE_X86)
+	QREVERSE_TARGET_SSSE3
+	static inline __m128i Reverse128(__m128i Vector)
+	{
+		return _mm_alignr_epi8(Vector, Vector, 8);
+	}
+
+	QREVERSE_TARGET_AVX2
+	static inline __m256i Reverse256(__m256i Vector)
+	{
+		Vector = _mm256_alignr_epi8(Vector, Vector, 8);
+		return _mm256_permute2x128_si256(Vector, Vector, 1);
+	}
+
+	QREVERSE_TARGET_AVX512
+	static inline __m512i Reverse512(__m512i Vector)
+	{
+		const __m512i ShuffleRev = _mm512_set_epi64(
+			0, 1, 2, 3, 4, 5, 6, 7
+		);
+		return _mm512_permutexvar_epi64(ShuffleRev, Vector);
+	}
+#endif
+
+#if defined(QREVERSE_NEON)
+	static inline uint8x16_t ReverseNEON(uint8x16_t Vector)
+	{
+		// Reverse the 64-bit lanes
+		uint64x2_t Vector64 = vreinterpretq_u64_u8(Vector);
+		Vector64 = vextq_u64( Vector64, Vector64, 1 );
+		return vreinterpretq_u8_u64(Vector64);
+	}
+#endif
+
+#if defined(QREVERSE_SVE)
+	static inline svuint8_t ReverseSVE(svuint8_t Vector)
+	{
+		return svreinterpret_u8_u64(
+			svrev_u64(svreinterpret_u64_u8(Vector))
+		);
+	}
+#endif
+};
+
+// 16 byte elements
+template<>
+struct RegisterReverse<16>
+{
+	// A 16-byte register holds exactly one element, so the 128-bit tiers
+	// only have to move it
+	static constexpr bool SSSE3  = true;
+	static constexpr bool AVX2   = true;
+	static constexpr bool AVX512 = true;
+	static constexpr bool NEON   = true;
+	static constexpr bool SVE    = true;
+
+#if defined(QREVERSE_X86)
+	QREVERSE_TARGET_SSSE3
+	static inline __m128i Reverse128(__m128i Vector)
+	{
+		return Vector;
+	}
+
+	QREVERSE_TARGET_AVX2
+	static inline __m256i Reverse256(__m256i Vector)
+	{
+		return _mm256_permute4x64_epi64( Vector, _MM_SHUFFLE(1,0,3,2) );
+	}
+
+	QREVERSE_TARGET_AVX512
+	static inline __m512i Reverse512(__m512i Vector)
+	{
+		const __m512i ShuffleRev = _mm512_set_epi64(
+			1, 0, 3, 2, 5, 4, 7, 6
+		);
+		return _mm512_permutexvar_epi64( ShuffleRev, Vector );
+	}
+#endif
+
+#if defined(QREVERSE_NEON)
+	static inline uint8x16_t ReverseNEON(uint8x16_t Vector)
+	{
+		return Vector;
+	}
+#endif
+
+#if defined(QREVERSE_SVE)
+	static inline svuint8_t ReverseSVE(svuint8_t Vector)
+	{
+		// Reverse the 8-byte halves and then swap each pair of them back
+		const svuint64_t ShuffleRev = sveor_n_u64_x(
+			svptrue_b64(), svrev_u64(svindex_u64(0, 1)), 1
+		);
+		return svreinterpret_u8_u64(
+			svtbl_u64(svreinterpret_u64_u8(Vector), ShuffleRev)
+		);
+	}
+#endif
+};
+
+// 32 byte elements
+template<>
+struct RegisterReverse<32>
+{
+	// Narrower registers only ever hold a part of an element, which the wide
+	// steps move without involving RegisterReverse
+	static constexpr bool SSSE3  = false;
+	static constexpr bool AVX2   = true;
+	static constexpr bool AVX512 = true;
+	static constexpr bool NEON   = false;
+	static constexpr bool SVE    = false;
+
+#if defined(QREVERSE_X86)
+	QREVERSE_TARGET_SSSE3
+	static inline __m128i Reverse128(__m128i Vector)
+	{
+		return Vector;
+	}
+
+	QREVERSE_TARGET_AVX2
+	static inline __m256i Reverse256(__m256i Vector)
+	{
+		return Vector;
+	}
+
+	QREVERSE_TARGET_AVX512
+	static inline __m512i Reverse512(__m512i Vector)
+	{
+		return _mm512_shuffle_i64x2( Vector, Vector, _MM_SHUFFLE(1,0,3,2) );
+	}
+#endif
+
+#if defined(QREVERSE_NEON)
+	static inline uint8x16_t ReverseNEON(uint8x16_t Vector)
+	{
+		return Vector;
+	}
+#endif
+
+#if defined(QREVERSE_SVE)
+	static inline svuint8_t ReverseSVE(svuint8_t Vector)
+	{
+		return Vector;
+	}
+#endif
+};
+
+/// Prefetching
+// The upper end of an array is streamed through backwards, which hardware
+// prefetchers follow worse than the ascending lower end. Arrays too large to
+// stay cached have the widest steps prefetch both ends a fixed distance ahead.
+// Below that, the requests only cost issue slots.
+
+// Bytes ahead of each end of the array that the prefetching steps request
+#if !defined(QREVERSE_PREFETCH_DISTANCE)
+#define QREVERSE_PREFETCH_DISTANCE 1024
+#endif
+
+// Arrays of at least this many bytes are reversed with prefetching
+#if !defined(QREVERSE_PREFETCH_THRESHOLD)
+#define QREVERSE_PREFETCH_THRESHOLD (16 * 1024 * 1024)
+#endif
+
+constexpr std::size_t PrefetchDistance = QREVERSE_PREFETCH_DISTANCE;
+constexpr std::size_t PrefetchThreshold = QREVERSE_PREFETCH_THRESHOLD;
+
+// Requests the cache line holding Address ahead of time. Prefetches never
+// fault, so Address may lie beyond either end of the array.
+inline void PrefetchLine(std::uintptr_t Address)
+{
+#if defined(QREVERSE_X86)
+	_mm_prefetch(reinterpret_cast<const char*>(Address), _MM_HINT_T0);
+#elif defined(_MSC_VER)
+	__prefetch(reinterpret_cast<const void*>(Address));
+#else
+	__builtin_prefetch(reinterpret_cast<const void*>(Address));
+#endif
+}
+
+// Prefetches ahead of the lower pointer of a step as it ascends and of the
+// upper pointer as it descends
+inline void PrefetchEnds(const void* Lower, const void* Upper)
+{
+	PrefetchLine(reinterpret_cast<std::uintptr_t>(Lower) + PrefetchDistance);
+	PrefetchLine(reinterpret_cast<std::uintptr_t>(Upper) - PrefetchDistance);
+}
+
+/// Unrolling
+// The widest steps exchange one register from each end per iteration by
+// default. The kernels run unrolled variants ahead of them that keep several
+// registers per end in flight for as long as the range still fits them all.
+
+// Registers exchanged from each end per iteration of the unrolled steps
+#if !defined(QREVERSE_UNROLL)
+#define QREVERSE_UNROLL 2
+#endif
+
+constexpr std::size_t UnrollCount = QREVERSE_UNROLL;
+
+/// Statistics
+// With QREVERSE_STATS defined, every step that moves any elements counts the
+// call, the elements it moved and the ticks it took towards its tier and
+// element size. Ticks are of the timestamp counter on x86 and nanoseconds
+// elsewhere. Without it the counting compiles away entirely.
+
+#if defined(QREVERSE_STATS)
+struct StepCounters
+{
+	std::atomic<std::uint64_t> Calls;
+	std::atomic<std::uint64_t> Elements;
+	std::atomic<std::uint64_t> Ticks;
+};
+
+template< std::size_t ElementSize >
+inline StepCounters* StatsCounters()
+{
+	static StepCounters Counters[static_cast<std::size_t>(Tier::Count)];
+	return Counters;
+}
+
+inline std::uint64_t StatsTicks()
+{
+#if defined(QREVERSE_X86)
+	return __rdtsc();
+#else
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()
+	).count();
+#endif
+}
+
+// Counts the elements that a step moved by the time it returns, PerIndex for
+// every index that it advanced
+class StepScope
+{
+public:
+	StepScope(StepCounters& Counters, const std::size_t& i, std::size_t PerIndex)
+		: Counters(Counters), i(i), Begin(i), PerIndex(PerIndex),
+		Start(StatsTicks())
+	{
+	}
+
+	~StepScope()
+	{
+		if( i == Begin )
+		{
+			return;
+		}
+		const std::uint64_t Ticks = StatsTicks() - Start;
+		Counters.Calls.fetch_add(1, std::memory_order_relaxed);
+		Counters.Elements.fetch_add(
+			(i - Begin) * PerIndex, std::memory_order_relaxed
+		);
+		Counters.Ticks.fetch_add(Ticks, std::memory_order_relaxed);
+	}
+
+private:
+	StepCounters& Counters;
+	const std::size_t& i;
+	const std::size_t Begin;
+	const std::size_t PerIndex;
+	const std::uint64_t Start;
+};
+
+#define QREVERSE_STEP_STATS(ElementSize, Level, PerIndex) \
+	const qreverse::detail::StepScope StepStats( \
+		qreverse::detail::StatsCounters<ElementSize>()[ \
+			static_cast<std::size_t>(Level) \
+		], \
+		i, PerIndex \
+	)
+#else
+#define QREVERSE_STEP_STATS(ElementSize, Level, PerIndex)
+#endif
+
+/// Tier steps
+// Each step exchanges the elements from index i onward with their mirrored
+// counterparts at Count - i - 1 for as long as its vector width still fits
+// before End, and returns the index at which the next tier continues. Element
+// sizes without an implementation for a tier fall through untouched.
+
+// The overlapping steps finish off a range that reaches the middle of the
+// array once the elements left between i and Count - i span one to two
+// registers of Width elements. A register is loaded from each end of them
+// before either is stored. Where the two overlap at the center, both reversed
+// registers carry the same elements, so the order of their stores does not
+// matter. Each replaces the narrower steps that would otherwise run after it.
+inline bool OverlapsMiddle(
+	std::size_t Count, std::size_t i, std::size_t End, std::size_t Width
+)
+{
+	return End == Count / 2 && i < End
+		&& Count - 2 * i >= Width && Count - 2 * i <= 2 * Width;
+}
+
+template< std::size_t ElementSize >
+inline std::size_t ReverseSerial(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::Serial, 2);
+	// An abstraction to treat the array elements purely as bytes
+	struct ByteElement
+	{
+		std::uint8_t u8[ElementSize];
+	};
+	ByteElement* ArrayN = reinterpret_cast<ByteElement*>(Array);
+
+	// If compiler adds any padding/alignment bytes(and some do) then assert out
+	static_assert(
+		sizeof(ByteElement) == ElementSize,
+		"ByteElement is pad-aligned and does not match specified element size"
+	);
+
+	for( ; i < End; ++i )
+	{
+		// Exchange the upper and lower element as we work our
+		// way down to the middle from either end
+		ByteElement Temp(ArrayN[i]);
+		ArrayN[i] = ArrayN[Count - i - 1];
+		ArrayN[Count - i - 1] = Temp;
+	}
+	return i;
+}
+
+template< std::size_t ElementSize >
+inline std::size_t ReverseSwap(
+	void*, std::size_t, std::size_t i, std::size_t
+)
+{
+	return i;
+}
+
+// One byte elements
+template<>
+inline std::size_t ReverseSwap<1>(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(1, Tier::Swap, 2);
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	// BSWAP 64
+	for( ; i + 8 <= End; i += 8 )
+	{
+		// Get bswapped versions of our Upper and Lower 8-byte chunks
+		std::uint64_t Lower = Swap64(
+			*reinterpret_cast<std::uint64_t*>(&Array8[i])
+		);
+		std::uint64_t Upper = Swap64(
+			*reinterpret_cast<std::uint64_t*>(&Array8[Count - i - 8])
+		);
+
+		// Place them at their swapped position
+		*reinterpret_cast<std::uint64_t*>(&Array8[i]) = Upper;
+		*reinterpret_cast<std::uint64_t*>(&Array8[Count - i - 8]) = Lower;
+	}
+	// BSWAP 32
+	for( ; i + 4 <= End; i += 4 )
+	{
+		// Get bswapped versions of our Upper and Lower 4-byte chunks
+		std::uint32_t Lower = Swap32(
+			*reinterpret_cast<std::uint32_t*>(&Array8[i])
+		);
+		std::uint32_t Upper = Swap32(
+			*reinterpret_cast<std::uint32_t*>(&Array8[Count - i - 4])
+		);
+
+		// Place them at their swapped position
+		*reinterpret_cast<std::uint32_t*>(&Array8[i]) = Upper;
+		*reinterpret_cast<std::uint32_t*>(&Array8[Count - i - 4]) = Lower;
+	}
+	// BSWAP 16
+	for( ; i + 2 <= End; i += 2 )
+	{
+		// Get bswapped versions of our Upper and Lower 4-byte chunks
+		std::uint16_t Lower = Swap16(
+			*reinterpret_cast<std::uint16_t*>(&Array8[i])
+		);
+		std::uint16_t Upper = Swap16(
+			*reinterpret_cast<std::uint16_t*>(&Array8[Count - i - 2])
+		);
+
+		// Place them at their swapped position
+		*reinterpret_cast<std::uint16_t*>(&Array8[i]) = Upper;
+		*reinterpret_cast<std::uint16_t*>(&Array8[Count - i - 2]) = Lower;
+	}
+	return i;
+}
+
+#if defined(QREVERSE_X86)
+// SSSE3
+template< std::size_t ElementSize >
+QREVERSE_TARGET_SSSE3
+inline std::size_t ReverseSSSE3(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::SSSE3, 2);
+	using Register = RegisterReverse<ElementSize>;
+	if( !Register::SSSE3 )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	// Elements per 16-byte register
+	const std::size_t Width = Register::SSSE3 ? 16 / ElementSize : 1;
+	for( ; i + Width <= End; i += Width )
+	{
+		__m128i Lower = _mm_loadu_si128(
+			reinterpret_cast<__m128i*>(&Array8[i * ElementSize])
+		);
+		__m128i Upper = _mm_loadu_si128(
+			reinterpret_cast<__m128i*>(&Array8[(Count - i - Width) * ElementSize])
+		);
+
+		Lower = Register::Reverse128(Lower);
+		Upper = Register::Reverse128(Upper);
+
+		// Place them at their swapped position
+		_mm_storeu_si128(
+			reinterpret_cast<__m128i*>(&Array8[i * ElementSize]),
+			Upper
+		);
+		_mm_storeu_si128(
+			reinterpret_cast<__m128i*>(&Array8[(Count - i - Width) * ElementSize]),
+			Lower
+		);
+	}
+	return i;
+}
+
+// SSSE3 overlapping middle
+template< std::size_t ElementSize >
+QREVERSE_TARGET_SSSE3
+inline std::size_t ReverseSSSE3Overlap(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::SSSE3, 2);
+	using Register = RegisterReverse<ElementSize>;
+	// Elements per 16-byte register
+	const std::size_t Width = Register::SSSE3 ? 16 / ElementSize : 1;
+	if( !Register::SSSE3 || !OverlapsMiddle(Count, i, End, Width) )
+	{
+		return i;
+	}
+	std::uint8_t* LowerPtr = reinterpret_cast<std::uint8_t*>(Array)
+		+ i * ElementSize;
+	std::uint8_t* UpperPtr = reinterpret_cast<std::uint8_t*>(Array)
+		+ (Count - i - Width) * ElementSize;
+
+	__m128i Lower = _mm_loadu_si128(reinterpret_cast<const __m128i*>(LowerPtr));
+	__m128i Upper = _mm_loadu_si128(reinterpret_cast<const __m128i*>(UpperPtr));
+
+	Lower = Register::Reverse128(Lower);
+	Upper = Register::Reverse128(Upper);
+
+	// Place them at their swapped position
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(LowerPtr), Upper);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(UpperPtr), Lower);
+	i = End;
+	return i;
+}
+
+// AVX-2
+template<
+	std::size_t ElementSize, Alignment Align = Alignment::None,
+	bool Prefetch = false, std::size_t Unroll = 1
+>
+QREVERSE_TARGET_AVX2
+inline std::size_t ReverseAVX2(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::AVX2, 2);
+	using Register = RegisterReverse<ElementSize>;
+	if( !Register::AVX2 )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	// Elements per 32-byte register
+	const std::size_t Width = Register::AVX2 ? 32 / ElementSize : 1;
+	// Each iteration exchanges Unroll registers from each end, independent of
+	// one another so that their loads and shuffles overlap
+	for( ; i + Width * Unroll <= End; i += Width * Unroll )
+	{
+		for( std::size_t k = 0; k < Unroll; ++k )
+		{
+			const std::size_t j = i + k * Width;
+			__m256i* LowerPtr = reinterpret_cast<__m256i*>(
+				&Array8[j * ElementSize]
+			);
+			__m256i* UpperPtr = reinterpret_cast<__m256i*>(
+				&Array8[(Count - j - Width) * ElementSize]
+			);
+
+			if( Prefetch )
+			{
+				PrefetchEnds(LowerPtr, UpperPtr);
+			}
+
+			__m256i Lower = Align != Alignment::None
+				? _mm256_load_si256(LowerPtr) : _mm256_loadu_si256(LowerPtr);
+			__m256i Upper = Align == Alignment::Both
+				? _mm256_load_si256(UpperPtr) : _mm256_loadu_si256(UpperPtr);
+
+			Lower = Register::Reverse256(Lower);
+			Upper = Register::Reverse256(Upper);
+
+			// Place them at their swapped position
+			if( Align != Alignment::None )
+			{
+				_mm256_store_si256(LowerPtr, Upper);
+			}
+			else
+			{
+				_mm256_storeu_si256(LowerPtr, Upper);
+			}
+			if( Align == Alignment::Both )
+			{
+				_mm256_store_si256(UpperPtr, Lower);
+			}
+			else
+			{
+				_mm256_storeu_si256(UpperPtr, Lower);
+			}
+		}
+	}
+	return i;
+}
+
+// AVX-2 overlapping middle
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX2
+inline std::size_t ReverseAVX2Overlap(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::AVX2, 2);
+	using Register = RegisterReverse<ElementSize>;
+	// Elements per 32-byte register
+	const std::size_t Width = Register::AVX2 ? 32 / ElementSize : 1;
+	if( !Register::AVX2 || !OverlapsMiddle(Count, i, End, Width) )
+	{
+		return i;
+	}
+	std::uint8_t* LowerPtr = reinterpret_cast<std::uint8_t*>(Array)
+		+ i * ElementSize;
+	std::uint8_t* UpperPtr = reinterpret_cast<std::uint8_t*>(Array)
+		+ (Count - i - Width) * ElementSize;
+
+	__m256i Lower = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(LowerPtr));
+	__m256i Upper = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(UpperPtr));
+
+	Lower = Register::Reverse256(Lower);
+	Upper = Register::Reverse256(Upper);
+
+	// Place them at their swapped position
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(LowerPtr), Upper);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(UpperPtr), Lower);
+	i = End;
+	return i;
+}
+
+// AVX-512BW/F
+template<
+	std::size_t ElementSize, Alignment Align = Alignment::None,
+	bool Prefetch = false, std::size_t Unroll = 1
+>
+QREVERSE_TARGET_AVX512
+inline std::size_t ReverseAVX512(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::AVX512, 2);
+	using Register = RegisterReverse<ElementSize>;
+	if( !Register::AVX512 )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	// Elements per 64-byte register
+	const std::size_t Width = Register::AVX512 ? 64 / ElementSize : 1;
+	// Each iteration exchanges Unroll registers from each end, independent of
+	// one another so that their loads and shuffles overlap
+	for( ; i + Width * Unroll <= End; i += Width * Unroll )
+	{
+		for( std::size_t k = 0; k < Unroll; ++k )
+		{
+			const std::size_t j = i + k * Width;
+			__m512i* LowerPtr = reinterpret_cast<__m512i*>(
+				&Array8[j * ElementSize]
+			);
+			__m512i* UpperPtr = reinterpret_cast<__m512i*>(
+				&Array8[(Count - j - Width) * ElementSize]
+			);
+
+			if( Prefetch )
+			{
+				PrefetchEnds(LowerPtr, UpperPtr);
+			}
+
+			__m512i Lower = Align != Alignment::None
+				? _mm512_load_si512(LowerPtr) : _mm512_loadu_si512(LowerPtr);
+			__m512i Upper = Align == Alignment::Both
+				? _mm512_load_si512(UpperPtr) : _mm512_loadu_si512(UpperPtr);
+
+			Lower = Register::Reverse512(Lower);
+			Upper = Register::Reverse512(Upper);
+
+			// Place them at their swapped position
+			if( Align != Alignment::None )
+			{
+				_mm512_store_si512(LowerPtr, Upper);
+			}
+			else
+			{
+				_mm512_storeu_si512(LowerPtr, Upper);
+			}
+			if( Align == Alignment::Both )
+			{
+				_mm512_store_si512(UpperPtr, Lower);
+			}
+			else
+			{
+				_mm512_storeu_si512(UpperPtr, Lower);
+			}
+		}
+	}
+	return i;
+}
+
+// AVX-512BW/F overlapping middle
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX512
+inline std::size_t ReverseAVX512Overlap(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::AVX512, 2);
+	using Register = RegisterReverse<ElementSize>;
+	// Elements per 64-byte register
+	const std::size_t Width = Register::AVX512 ? 64 / ElementSize : 1;
+	if( !Register::AVX512 || !OverlapsMiddle(Count, i, End, Width) )
+	{
+		return i;
+	}
+	std::uint8_t* LowerPtr = reinterpret_cast<std::uint8_t*>(Array)
+		+ i * ElementSize;
+	std::uint8_t* UpperPtr = reinterpret_cast<std::uint8_t*>(Array)
+		+ (Count - i - Width) * ElementSize;
+
+	__m512i Lower = _mm512_loadu_si512(LowerPtr);
+	__m512i Upper = _mm512_loadu_si512(UpperPtr);
+
+	Lower = Register::Reverse512(Lower);
+	Upper = Register::Reverse512(Upper);
+
+	// Place them at their swapped position
+	_mm512_storeu_si512(LowerPtr, Upper);
+	_mm512_storeu_si512(UpperPtr, Lower);
+	i = End;
+	return i;
+}
+
+// AVX-512BW/F masked remainder
+// Exchanges a range of less than a register's worth of elements in a single
+// step. The upper elements are loaded into the top of the register that ends
+// with them so that reversing it lands them in its bottom, ready to be stored
+// at the lower end. Masking keeps every access within the elements being
+// exchanged, even where the register would start before the array.
+// Masked loads are not forwarded from earlier stores to the same lines, so
+// this only pays off as the first step of a kernel and only for ranges that
+// the AVX-2 step could not finish on its own.
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX512
+inline std::size_t ReverseAVX512Masked(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::AVX512, 2);
+	using Register = RegisterReverse<ElementSize>;
+	// Elements per 64-byte register
+	const std::size_t Width = Register::AVX512 ? 64 / ElementSize : 1;
+	if(
+		!Register::AVX512 || End <= i || End - i >= Width
+		|| (End - i) * ElementSize <= 32
+	)
+	{
+		return i;
+	}
+	const std::size_t Bytes = (End - i) * ElementSize;
+	const __mmask64 LowerMask = (1ull << Bytes) - 1;
+	const __mmask64 UpperMask = ~0ull << (64 - Bytes);
+
+	std::uint8_t* LowerPtr =
+		reinterpret_cast<std::uint8_t*>(Array) + i * ElementSize;
+	std::uint8_t* UpperPtr = reinterpret_cast<std::uint8_t*>(
+		reinterpret_cast<std::uintptr_t>(Array) + (Count - i) * ElementSize - 64
+	);
+
+	__m512i Lower = _mm512_maskz_loadu_epi8(LowerMask, LowerPtr);
+	__m512i Upper = _mm512_maskz_loadu_epi8(UpperMask, UpperPtr);
+
+	Lower = Register::Reverse512(Lower);
+	Upper = Register::Reverse512(Upper);
+
+	// Place them at their swapped position
+	_mm512_mask_storeu_epi8(LowerPtr, LowerMask, Upper);
+	_mm512_mask_storeu_epi8(UpperPtr, UpperMask, Lower);
+	i = End;
+	return i;
+}
+
+// AVX-512BW/F whole array
+// Reverses a whole array of 1 to 64 bytes in a single step without a branch on
+// its size. The array is loaded into the top of a register so that reversing
+// it lands the elements in the bottom, ready to be stored back. As with ReverseAVX512Masked this only pays off for
+// an array that no earlier store has touched, such as the small arrays of a
+// batch or a fixed-count array.
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX512
+inline void ReverseWholeAVX512(void* Array, std::size_t Count)
+{
+	const std::size_t Bytes = Count * ElementSize;
+	const __mmask64 LowerMask = ~0ull >> (64 - Bytes);
+	const __mmask64 UpperMask = ~0ull << (64 - Bytes);
+	const __m512i Vector = _mm512_maskz_loadu_epi8(
+		UpperMask,
+		reinterpret_cast<const void*>(
+			reinterpret_cast<std::uintptr_t>(Array) + Bytes - 64
+		)
+	);
+	_mm512_mask_storeu_epi8(
+		Array, LowerMask, RegisterReverse<ElementSize>::Reverse512(Vector)
+	);
+}
+#endif
+
+#if defined(QREVERSE_NEON)
+// NEON
+template< std::size_t ElementSize, bool Prefetch = false >
+inline std::size_t ReverseNEON(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::NEON, 2);
+	using Register = RegisterReverse<ElementSize>;
+	if( !Register::NEON )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	// Elements per 16-byte register
+	const std::size_t Width = Register::NEON ? 16 / ElementSize : 1;
+	for( ; i + Width <= End; i += Width )
+	{
+		if( Prefetch )
+		{
+			PrefetchEnds(
+				&Array8[i * ElementSize], &Array8[(Count - i - Width) * ElementSize]
+			);
+		}
+
+		uint8x16_t Lower = vld1q_u8( &Array8[i * ElementSize] );
+		uint8x16_t Upper = vld1q_u8( &Array8[(Count - i - Width) * ElementSize] );
+
+		Lower = Register::ReverseNEON(Lower);
+		Upper = Register::ReverseNEON(Upper);
+
+		// Place them at their swapped position
+		vst1q_u8( &Array8[i * ElementSize], Upper );
+		vst1q_u8( &Array8[(Count - i - Width) * ElementSize], Lower );
+	}
+	return i;
+}
+
+// NEON overlapping middle
+template< std::size_t ElementSize >
+inline std::size_t ReverseNEONOverlap(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::NEON, 2);
+	using Register = RegisterReverse<ElementSize>;
+	// Elements per 16-byte register
+	const std::size_t Width = Register::NEON ? 16 / ElementSize : 1;
+	if( !Register::NEON || !OverlapsMiddle(Count, i, End, Width) )
+	{
+		return i;
+	}
+	std::uint8_t* LowerPtr = reinterpret_cast<std::uint8_t*>(Array)
+		+ i * ElementSize;
+	std::uint8_t* UpperPtr = reinterpret_cast<std::uint8_t*>(Array)
+		+ (Count - i - Width) * ElementSize;
+
+	uint8x16_t Lower = vld1q_u8(LowerPtr);
+	uint8x16_t Upper = vld1q_u8(UpperPtr);
+
+	Lower = Register::ReverseNEON(Lower);
+	Upper = Register::ReverseNEON(Upper);
+
+	// Place them at their swapped position
+	vst1q_u8(LowerPtr, Upper);
+	vst1q_u8(UpperPtr, Lower);
+	i = End;
+	return i;
+}
+#endif
+
+#if defined(QREVERSE_SVE)
+// SVE
+// The register width is only known at run-time, and the final partial
+// register's worth of elements is exchanged by the same loop under a
+// predicate. The upper elements are loaded into the top lanes of the register
+// that ends with them so that reversing it places them in the lanes that the
+// lower predicate selects, and the other way around. Inactive lanes are never
+// accessed, even where the register would start before the array.
+template< std::size_t ElementSize >
+inline std::size_t ReverseSVE(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::SVE, 2);
+	using Register = RegisterReverse<ElementSize>;
+	if( !Register::SVE )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	// Bytes and elements per register
+	const std::size_t VectorSize = svcntb();
+	const std::size_t Width = VectorSize / ElementSize;
+	for( ; i < End; i += Width )
+	{
+		const std::size_t Bytes =
+			(End - i < Width ? End - i : Width) * ElementSize;
+		const svbool_t LowerMask = svwhilelt_b8_u64(0, Bytes);
+		const svbool_t UpperMask = svrev_b8(LowerMask);
+
+		std::uint8_t* LowerPtr = &Array8[i * ElementSize];
+		std::uint8_t* UpperPtr = reinterpret_cast<std::uint8_t*>(
+			reinterpret_cast<std::uintptr_t>(Array)
+			+ (Count - i) * ElementSize - VectorSize
+		);
+
+		const svuint8_t Lower = Register::ReverseSVE(
+			svld1_u8(LowerMask, LowerPtr)
+		);
+		const svuint8_t Upper = Register::ReverseSVE(
+			svld1_u8(UpperMask, UpperPtr)
+		);
+
+		// Place them at their swapped position
+		svst1_u8(LowerMask, LowerPtr, Upper);
+		svst1_u8(UpperMask, UpperPtr, Lower);
+	}
+	// The last register may only have been partially active
+	i = End;
+	return i;
+}
+#endif
+
+/// Non-power-of-two element sizes
+// Elements of 3 and 6 bytes do not evenly fill a 16-byte register, but
+// sixteen or eight of them exactly fill three. These are reversed 48 bytes at
+// a time with every output register gathered from the three input registers
+// with one shuffle each.
+// Elements of 12 and 24 bytes are left to the serial swaps, which already
+// move each of them with two or three wide loads and stores. Shuffling them
+// within registers only adds work on top of the same memory traffic.
+
+template< std::size_t ElementSize >
+struct Block48Masks
+{
+	static_assert(
+		48 % ElementSize == 0,
+		"ElementSize does not evenly divide a 48-byte block"
+	);
+
+	// Masks[r][s] selects the bytes of output register r that come from input
+	// register s, and zeroes the rest
+	std::uint8_t Masks[3][3][16];
+
+	Block48Masks()
+	{
+		const std::size_t Width = 48 / ElementSize;
+		for( std::size_t r = 0; r < 3; ++r )
+		{
+			for( std::size_t j = 0; j < 16; ++j )
+			{
+				const std::size_t Byte = r * 16 + j;
+				const std::size_t Source =
+					(Width - 1 - Byte / ElementSize) * ElementSize
+					+ Byte % ElementSize;
+				for( std::size_t s = 0; s < 3; ++s )
+				{
+					Masks[r][s][j] = static_cast<std::uint8_t>(
+						Source / 16 == s ? Source % 16 : 0x80
+					);
+				}
+			}
+		}
+	}
+
+	static const Block48Masks& Get()
+	{
+		static const Block48Masks Table;
+		return Table;
+	}
+};
+
+// Byte permutation that reverses the order of the whole elements packed into
+// the low bytes of a 64-byte register
+template< std::size_t ElementSize >
+struct Register64Indices
+{
+	std::uint8_t Index[64];
+
+	Register64Indices()
+	{
+		const std::size_t Width = 64 / ElementSize;
+		for( std::size_t j = 0; j < 64; ++j )
+		{
+			Index[j] = static_cast<std::uint8_t>(
+				j < Width * ElementSize
+					? (Width - 1 - j / ElementSize) * ElementSize
+						+ j % ElementSize
+					: j
+			);
+		}
+	}
+
+	static const Register64Indices& Get()
+	{
+		static const Register64Indices Table;
+		return Table;
+	}
+};
+
+#if defined(QREVERSE_X86)
+// SSSE3
+template< std::size_t ElementSize >
+QREVERSE_TARGET_SSSE3
+inline std::size_t ReverseSSSE3Block48(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::SSSE3, 2);
+	// Elements per 48-byte block
+	const std::size_t Width = 48 / ElementSize;
+	if( i + Width > End )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+
+	__m128i Masks[3][3];
+	for( std::size_t r = 0; r < 3; ++r )
+	{
+		for( std::size_t s = 0; s < 3; ++s )
+		{
+			Masks[r][s] = _mm_loadu_si128(
+				reinterpret_cast<const __m128i*>(
+					Block48Masks<ElementSize>::Get().Masks[r][s]
+				)
+			);
+		}
+	}
+
+	for( ; i + Width <= End; i += Width )
+	{
+		std::uint8_t* LowerBlock = &Array8[i * ElementSize];
+		std::uint8_t* UpperBlock = &Array8[(Count - i - Width) * ElementSize];
+
+		// Load 48 bytes from either end into three 16-byte registers each
+		__m128i Lower[3];
+		__m128i Upper[3];
+		for( std::size_t s = 0; s < 3; ++s )
+		{
+			Lower[s] = _mm_loadu_si128(
+				reinterpret_cast<__m128i*>(&LowerBlock[s * 16])
+			);
+			Upper[s] = _mm_loadu_si128(
+				reinterpret_cast<__m128i*>(&UpperBlock[s * 16])
+			);
+		}
+
+		// Gather each reversed register from all three input registers and
+		// place them at their swapped position
+		for( std::size_t r = 0; r < 3; ++r )
+		{
+			__m128i LowerRev = _mm_setzero_si128();
+			__m128i UpperRev = _mm_setzero_si128();
+			for( std::size_t s = 0; s < 3; ++s )
+			{
+				LowerRev = _mm_or_si128(
+					LowerRev, _mm_shuffle_epi8(Lower[s], Masks[r][s])
+				);
+				UpperRev = _mm_or_si128(
+					UpperRev, _mm_shuffle_epi8(Upper[s], Masks[r][s])
+				);
+			}
+			_mm_storeu_si128(
+				reinterpret_cast<__m128i*>(&LowerBlock[r * 16]),
+				UpperRev
+			);
+			_mm_storeu_si128(
+				reinterpret_cast<__m128i*>(&UpperBlock[r * 16]),
+				LowerRev
+			);
+		}
+	}
+	return i;
+}
+
+// 3 and 6 byte elements
+template<>
+QREVERSE_TARGET_SSSE3
+inline std::size_t ReverseSSSE3<3>(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	return ReverseSSSE3Block48<3>(Array, Count, i, End);
+}
+
+template<>
+QREVERSE_TARGET_SSSE3
+inline std::size_t ReverseSSSE3<6>(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	return ReverseSSSE3Block48<6>(Array, Count, i, End);
+}
+
+// AVX-512VBMI
+// vpermb can move any byte of a 64-byte register to any other, so small odd
+// element sizes are reversed by packing as many whole elements as fit into
+// the low bytes of a register with a masked load. Element sizes that already
+// have a whole-register permutation are left to the AVX-512 step.
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX512VBMI
+inline std::size_t ReverseAVX512VBMI(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::AVX512VBMI, 2);
+	if( RegisterReverse<ElementSize>::AVX512 || ElementSize >= 8 )
+	{
+		return i;
+	}
+	// Elements per 64-byte register
+	const std::size_t Width = ElementSize < 8 ? 64 / ElementSize : 1;
+	if( i + Width > End )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	const __mmask64 Mask = Width * ElementSize < 64
+		? (1ull << (Width * ElementSize)) - 1 : ~0ull;
+	const __m512i ShuffleRev = _mm512_loadu_si512(
+		Register64Indices<ElementSize>::Get().Index
+	);
+	for( ; i + Width <= End; i += Width )
+	{
+		__m512i Lower = _mm512_maskz_loadu_epi8(
+			Mask, &Array8[i * ElementSize]
+		);
+		__m512i Upper = _mm512_maskz_loadu_epi8(
+			Mask, &Array8[(Count - i - Width) * ElementSize]
+		);
+
+		Lower = _mm512_permutexvar_epi8(ShuffleRev, Lower);
+		Upper = _mm512_permutexvar_epi8(ShuffleRev, Upper);
+
+		// Place them at their swapped position
+		_mm512_mask_storeu_epi8(
+			&Array8[i * ElementSize], Mask, Upper
+		);
+		_mm512_mask_storeu_epi8(
+			&Array8[(Count - i - Width) * ElementSize], Mask, Lower
+		);
+	}
+	return i;
+}
+#endif
+
+#if defined(QREVERSE_NEON)
+// NEON
+// vld3 de-interleaves 48 bytes into three registers holding the first, second
+// and third byte or half-word of every element, which then only have to be reversed lane
+// by lane before vst3 interleaves them back together.
+template<>
+inline std::size_t ReverseNEON<3>(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(3, Tier::NEON, 2);
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	for( ; i + 16 <= End; i += 16 )
+	{
+		uint8x16x3_t Lower = vld3q_u8( &Array8[i * 3] );
+		uint8x16x3_t Upper = vld3q_u8( &Array8[(Count - i - 16) * 3] );
+		for( std::size_t c = 0; c < 3; ++c )
+		{
+			Lower.val[c] = RegisterReverse<1>::ReverseNEON( Lower.val[c] );
+			Upper.val[c] = RegisterReverse<1>::ReverseNEON( Upper.val[c] );
+		}
+		vst3q_u8( &Array8[i * 3], Upper );
+		vst3q_u8( &Array8[(Count - i - 16) * 3], Lower );
+	}
+	return i;
+}
+
+template<>
+inline std::size_t ReverseNEON<6>(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(6, Tier::NEON, 2);
+	std::uint16_t* Array16 = reinterpret_cast<std::uint16_t*>(Array);
+	for( ; i + 8 <= End; i += 8 )
+	{
+		uint16x8x3_t Lower = vld3q_u16( &Array16[i * 3] );
+		uint16x8x3_t Upper = vld3q_u16( &Array16[(Count - i - 8) * 3] );
+		for( std::size_t c = 0; c < 3; ++c )
+		{
+			Lower.val[c] = vreinterpretq_u16_u8(
+				RegisterReverse<2>::ReverseNEON(
+					vreinterpretq_u8_u16(Lower.val[c])
+				)
+			);
+			Upper.val[c] = vreinterpretq_u16_u8(
+				RegisterReverse<2>::ReverseNEON(
+					vreinterpretq_u8_u16(Upper.val[c])
+				)
+			);
+		}
+		vst3q_u16( &Array16[i * 3], Upper );
+		vst3q_u16( &Array16[(Count - i - 8) * 3], Lower );
+	}
+	return i;
+}
+
+#endif
+
+/// Wide element sizes
+// Elements spanning several whole registers need no shuffling within them.
+// Each pair of elements is exchanged a register at a time using the widest
+// registers that evenly divide an element. Where two or more elements fit
+// within a register, RegisterReverse permutes them instead, like the 32-byte
+// elements within an AVX-512 register.
+
+#if defined(QREVERSE_X86)
+// SSSE3
+template< std::size_t ElementSize >
+QREVERSE_TARGET_SSSE3
+inline std::size_t ReverseWideSSSE3(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::SSSE3, 2);
+	if( ElementSize <= 16 || ElementSize % 16 )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	// 16-byte registers per element
+	const std::size_t Registers = ElementSize / 16;
+	for( ; i < End; ++i )
+	{
+		std::uint8_t* LowerPtr = &Array8[i * ElementSize];
+		std::uint8_t* UpperPtr = &Array8[(Count - i - 1) * ElementSize];
+		for( std::size_t r = 0; r < Registers; ++r )
+		{
+			const __m128i Lower = _mm_loadu_si128(
+				reinterpret_cast<const __m128i*>(&LowerPtr[r * 16])
+			);
+			const __m128i Upper = _mm_loadu_si128(
+				reinterpret_cast<const __m128i*>(&UpperPtr[r * 16])
+			);
+
+			// Place them at their swapped position
+			_mm_storeu_si128(
+				reinterpret_cast<__m128i*>(&LowerPtr[r * 16]), Upper
+			);
+			_mm_storeu_si128(
+				reinterpret_cast<__m128i*>(&UpperPtr[r * 16]), Lower
+			);
+		}
+	}
+	return i;
+}
+
+// AVX-2
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX2
+inline std::size_t ReverseWideAVX2(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::AVX2, 2);
+	if( ElementSize <= 32 || ElementSize % 32 )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	// 32-byte registers per element
+	const std::size_t Registers = ElementSize / 32;
+	for( ; i < End; ++i )
+	{
+		std::uint8_t* LowerPtr = &Array8[i * ElementSize];
+		std::uint8_t* UpperPtr = &Array8[(Count - i - 1) * ElementSize];
+		for( std::size_t r = 0; r < Registers; ++r )
+		{
+			const __m256i Lower = _mm256_loadu_si256(
+				reinterpret_cast<const __m256i*>(&LowerPtr[r * 32])
+			);
+			const __m256i Upper = _mm256_loadu_si256(
+				reinterpret_cast<const __m256i*>(&UpperPtr[r * 32])
+			);
+
+			// Place them at their swapped position
+			_mm256_storeu_si256(
+				reinterpret_cast<__m256i*>(&LowerPtr[r * 32]), Upper
+			);
+			_mm256_storeu_si256(
+				reinterpret_cast<__m256i*>(&UpperPtr[r * 32]), Lower
+			);
+		}
+	}
+	return i;
+}
+
+// AVX-512F
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX512
+inline std::size_t ReverseWideAVX512(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::AVX512, 2);
+	if( ElementSize < 64 || ElementSize % 64 )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	// 64-byte registers per element
+	const std::size_t Registers = ElementSize / 64;
+	for( ; i < End; ++i )
+	{
+		std::uint8_t* LowerPtr = &Array8[i * ElementSize];
+		std::uint8_t* UpperPtr = &Array8[(Count - i - 1) * ElementSize];
+		for( std::size_t r = 0; r < Registers; ++r )
+		{
+			const __m512i Lower = _mm512_loadu_si512(&LowerPtr[r * 64]);
+			const __m512i Upper = _mm512_loadu_si512(&UpperPtr[r * 64]);
+
+			// Place them at their swapped position
+			_mm512_storeu_si512(&LowerPtr[r * 64], Upper);
+			_mm512_storeu_si512(&UpperPtr[r * 64], Lower);
+		}
+	}
+	return i;
+}
+#endif
+
+#if defined(QREVERSE_NEON)
+// NEON
+template< std::size_t ElementSize >
+inline std::size_t ReverseWideNEON(
+	void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::NEON, 2);
+	if( ElementSize <= 16 || ElementSize % 16 )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	// 16-byte registers per element
+	const std::size_t Registers = ElementSize / 16;
+	for( ; i < End; ++i )
+	{
+		std::uint8_t* LowerPtr = &Array8[i * ElementSize];
+		std::uint8_t* UpperPtr = &Array8[(Count - i - 1) * ElementSize];
+		for( std::size_t r = 0; r < Registers; ++r )
+		{
+			const uint8x16_t Lower = vld1q_u8(&LowerPtr[r * 16]);
+			const uint8x16_t Upper = vld1q_u8(&UpperPtr[r * 16]);
+
+			// Place them at their swapped position
+			vst1q_u8(&LowerPtr[r * 16], Upper);
+			vst1q_u8(&UpperPtr[r * 16], Lower);
+		}
+	}
+	return i;
+}
+#endif
+
+/// Reverse-copy steps
+// Same as the tier steps, but rather than exchanging both ends in-place these
+// read Src from the head and write Dst from the tail, running over the whole
+// array rather than half of it. When Stream is set the stores bypass the cache
+// and Dst must already be aligned to the width of the register at index i.
+
+template< std::size_t ElementSize >
+inline std::size_t ReverseCopySerial(
+	const void* Src, void* Dst, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::Serial, 1);
+	struct ByteElement
+	{
+		std::uint8_t u8[ElementSize];
+	};
+	const ByteElement* SrcN = reinterpret_cast<const ByteElement*>(Src);
+	ByteElement* DstN = reinterpret_cast<ByteElement*>(Dst);
+	for( ; i < End; ++i )
+	{
+		DstN[Count - i - 1] = SrcN[i];
+	}
+	return i;
+}
+
+template< std::size_t ElementSize >
+inline std::size_t ReverseCopySwap(
+	const void*, void*, std::size_t, std::size_t i
+)
+{
+	return i;
+}
+
+// One byte elements
+template<>
+inline std::size_t ReverseCopySwap<1>(
+	const void* Src, void* Dst, std::size_t Count, std::size_t i
+)
+{
+	QREVERSE_STEP_STATS(1, Tier::Swap, 1);
+	const std::uint8_t* Src8 = reinterpret_cast<const std::uint8_t*>(Src);
+	std::uint8_t* Dst8 = reinterpret_cast<std::uint8_t*>(Dst);
+	// BSWAP 64
+	for( ; i + 8 <= Count; i += 8 )
+	{
+		*reinterpret_cast<std::uint64_t*>(&Dst8[Count - i - 8]) = Swap64(
+			*reinterpret_cast<const std::uint64_t*>(&Src8[i])
+		);
+	}
+	// BSWAP 32
+	for( ; i + 4 <= Count; i += 4 )
+	{
+		*reinterpret_cast<std::uint32_t*>(&Dst8[Count - i - 4]) = Swap32(
+			*reinterpret_cast<const std::uint32_t*>(&Src8[i])
+		);
+	}
+	// BSWAP 16
+	for( ; i + 2 <= Count; i += 2 )
+	{
+		*reinterpret_cast<std::uint16_t*>(&Dst8[Count - i - 2]) = Swap16(
+			*reinterpret_cast<const std::uint16_t*>(&Src8[i])
+		);
+	}
+	return i;
+}
+
+#if defined(QREVERSE_X86)
+// SSSE3
+template< std::size_t ElementSize, bool Stream >
+QREVERSE_TARGET_SSSE3
+inline std::size_t ReverseCopySSSE3(
+	const void* Src, void* Dst, std::size_t Count, std::size_t i
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::SSSE3, 1);
+	using Register = RegisterReverse<ElementSize>;
+	if( !Register::SSSE3 )
+	{
+		return i;
+	}
+	const std::uint8_t* Src8 = reinterpret_cast<const std::uint8_t*>(Src);
+	std::uint8_t* Dst8 = reinterpret_cast<std::uint8_t*>(Dst);
+	const std::size_t Width = Register::SSSE3 ? 16 / ElementSize : 1;
+	for( ; i + Width <= Count; i += Width )
+	{
+		const __m128i Vector = Register::Reverse128(
+			_mm_loadu_si128(
+				reinterpret_cast<const __m128i*>(&Src8[i * ElementSize])
+			)
+		);
+		__m128i* Target = reinterpret_cast<__m128i*>(
+			&Dst8[(Count - i - Width) * ElementSize]
+		);
+		if( Stream )
+		{
+			_mm_stream_si128(Target, Vector);
+		}
+		else
+		{
+			_mm_storeu_si128(Target, Vector);
+		}
+	}
+	return i;
+}
+
+// AVX-2
+template< std::size_t ElementSize, bool Stream >
+QREVERSE_TARGET_AVX2
+inline std::size_t ReverseCopyAVX2(
+	const void* Src, void* Dst, std::size_t Count, std::size_t i
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::AVX2, 1);
+	using Register = RegisterReverse<ElementSize>;
+	if( !Register::AVX2 )
+	{
+		return i;
+	}
+	const std::uint8_t* Src8 = reinterpret_cast<const std::uint8_t*>(Src);
+	std::uint8_t* Dst8 = reinterpret_cast<std::uint8_t*>(Dst);
+	const std::size_t Width = Register::AVX2 ? 32 / ElementSize : 1;
+	for( ; i + Width <= Count; i += Width )
+	{
+		const __m256i Vector = Register::Reverse256(
+			_mm256_loadu_si256(
+				reinterpret_cast<const __m256i*>(&Src8[i * ElementSize])
+			)
+		);
+		__m256i* Target = reinterpret_cast<__m256i*>(
+			&Dst8[(Count - i - Width) * ElementSize]
+		);
+		if( Stream )
+		{
+			_mm256_stream_si256(Target, Vector);
+		}
+		else
+		{
+			_mm256_storeu_si256(Target, Vector);
+		}
+	}
+	return i;
+}
+
+// AVX-512BW/F
+template< std::size_t ElementSize, bool Stream >
+QREVERSE_TARGET_AVX512
+inline std::size_t ReverseCopyAVX512(
+	const void* Src, void* Dst, std::size_t Count, std::size_t i
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::AVX512, 1);
+	using Register = RegisterReverse<ElementSize>;
+	if( !Register::AVX512 )
+	{
+		return i;
+	}
+	const std::uint8_t* Src8 = reinterpret_cast<const std::uint8_t*>(Src);
+	std::uint8_t* Dst8 = reinterpret_cast<std::uint8_t*>(Dst);
+	const std::size_t Width = Register::AVX512 ? 64 / ElementSize : 1;
+	for( ; i + Width <= Count; i += Width )
+	{
+		const __m512i Vector = Register::Reverse512(
+			_mm512_loadu_si512(
+				reinterpret_cast<const __m512i*>(&Src8[i * ElementSize])
+			)
+		);
+		__m512i* Target = reinterpret_cast<__m512i*>(
+			&Dst8[(Count - i - Width) * ElementSize]
+		);
+		if( Stream )
+		{
+			_mm512_stream_si512(Target, Vector);
+		}
+		else
+		{
+			_mm512_storeu_si512(Target, Vector);
+		}
+	}
+	return i;
+}
+#endif
+
+#if defined(QREVERSE_NEON)
+// NEON
+template< std::size_t ElementSize >
+inline std::size_t ReverseCopyNEON(
+	const void* Src, void* Dst, std::size_t Count, std::size_t i
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::NEON, 1);
+	using Register = RegisterReverse<ElementSize>;
+	if( !Register::NEON )
+	{
+		return i;
+	}
+	const std::uint8_t* Src8 = reinterpret_cast<const std::uint8_t*>(Src);
+	std::uint8_t* Dst8 = reinterpret_cast<std::uint8_t*>(Dst);
+	const std::size_t Width = Register::NEON ? 16 / ElementSize : 1;
+	for( ; i + Width <= Count; i += Width )
+	{
+		vst1q_u8(
+			&Dst8[(Count - i - Width) * ElementSize],
+			Register::ReverseNEON( vld1q_u8( &Src8[i * ElementSize] ) )
+		);
+	}
+	return i;
+}
+#endif
+
+#if defined(QREVERSE_SVE)
+// SVE
+template< std::size_t ElementSize >
+inline std::size_t ReverseCopySVE(
+	const void* Src, void* Dst, std::size_t Count, std::size_t i
+)
+{
+	QREVERSE_STEP_STATS(ElementSize, Tier::SVE, 1);
+	using Register = RegisterReverse<ElementSize>;
+	if( !Register::SVE )
+	{
+		return i;
+	}
+	const std::uint8_t* Src8 = reinterpret_cast<const std::uint8_t*>(Src);
+	const std::size_t VectorSize = svcntb();
+	const std::size_t Width = VectorSize / ElementSize;
+	for( ; i < Count; i += Width )
+	{
+		const std::size_t Bytes =
+			(Count - i < Width ? Count - i : Width) * ElementSize;
+		const svbool_t SrcMask = svwhilelt_b8_u64(0, Bytes);
+		const svbool_t DstMask = svrev_b8(SrcMask);
+		// The destination register ends with the mirrored elements
+		std::uint8_t* Target = reinterpret_cast<std::uint8_t*>(
+			reinterpret_cast<std::uintptr_t>(Dst)
+			+ (Count - i) * ElementSize - VectorSize
+		);
+		svst1_u8(
+			DstMask, Target,
+			Register::ReverseSVE(svld1_u8(SrcMask, &Src8[i * ElementSize]))
+		);
+	}
+	return Count;
+}
+#endif
+
+/// Byteswap steps
+// Reverse the bytes within each element while leaving the elements where they
+// are. Within a power-of-two element byte j trades places with byte
+// j ^ (ElementSize - 1), so a single in-lane shuffle swaps every element of a
+// register at once.
+
+template< std::size_t ElementSize >
+inline std::size_t ByteswapSerial(
+	void* Array, std::size_t Count, std::size_t i
+)
+{
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	for( ; i < Count; ++i )
+	{
+		std::uint8_t* Element = &Array8[i * ElementSize];
+		for( std::size_t j = 0; j < ElementSize / 2; ++j )
+		{
+			const std::uint8_t Temp = Element[j];
+			Element[j] = Element[ElementSize - j - 1];
+			Element[ElementSize - j - 1] = Temp;
+		}
+	}
+	return i;
+}
+
+template< std::size_t ElementSize >
+inline std::size_t ByteswapSwap(void*, std::size_t, std::size_t i)
+{
+	return i;
+}
+
+// Two byte elements
+template<>
+inline std::size_t ByteswapSwap<2>(void* Array, std::size_t Count, std::size_t i)
+{
+	std::uint16_t* Array16 = reinterpret_cast<std::uint16_t*>(Array);
+	for( ; i < Count; ++i )
+	{
+		Array16[i] = Swap16(Array16[i]);
+	}
+	return i;
+}
+
+// Four byte elements
+template<>
+inline std::size_t ByteswapSwap<4>(void* Array, std::size_t Count, std::size_t i)
+{
+	std::uint32_t* Array32 = reinterpret_cast<std::uint32_t*>(Array);
+	for( ; i < Count; ++i )
+	{
+		Array32[i] = Swap32(Array32[i]);
+	}
+	return i;
+}
+
+// 8 byte elements
+template<>
+inline std::size_t ByteswapSwap<8>(void* Array, std::size_t Count, std::size_t i)
+{
+	std::uint64_t* Array64 = reinterpret_cast<std::uint64_t*>(Array);
+	for( ; i < Count; ++i )
+	{
+		Array64[i] = Swap64(Array64[i]);
+	}
+	return i;
+}
+
+// 16 byte elements
+template<>
+inline std::size_t ByteswapSwap<16>(void* Array, std::size_t Count, std::size_t i)
+{
+	std::uint64_t* Array64 = reinterpret_cast<std::uint64_t*>(Array);
+	for( ; i < Count; ++i )
+	{
+		// Swap each half and then the halves themselves
+		const std::uint64_t Lower = Swap64(Array64[i * 2 + 0]);
+		const std::uint64_t Upper = Swap64(Array64[i * 2 + 1]);
+		Array64[i * 2 + 0] = Upper;
+		Array64[i * 2 + 1] = Lower;
+	}
+	return i;
+}
+
+#if defined(QREVERSE_X86)
+// Shuffle that reverses every ElementSize-byte group of a 16-byte lane
+template< std::size_t ElementSize >
+QREVERSE_TARGET_SSSE3
+inline __m128i ByteswapShuffle128()
+{
+	const char Mask = static_cast<char>(ElementSize - 1);
+	return _mm_set_epi8(
+		15 ^ Mask, 14 ^ Mask, 13 ^ Mask, 12 ^ Mask,
+		11 ^ Mask, 10 ^ Mask,  9 ^ Mask,  8 ^ Mask,
+		 7 ^ Mask,  6 ^ Mask,  5 ^ Mask,  4 ^ Mask,
+		 3 ^ Mask,  2 ^ Mask,  1 ^ Mask,  0 ^ Mask
+	);
+}
+
+// SSSE3
+template< std::size_t ElementSize >
+QREVERSE_TARGET_SSSE3
+inline std::size_t ByteswapSSSE3(void* Array, std::size_t Count, std::size_t i)
+{
+	if( ElementSize == 1 || 16 % ElementSize )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	// Elements per 16-byte register
+	const std::size_t Width = ElementSize <= 16 ? 16 / ElementSize : 1;
+	const __m128i Shuffle = ByteswapShuffle128<ElementSize>();
+	for( ; i + Width <= Count; i += Width )
+	{
+		__m128i* Vector = reinterpret_cast<__m128i*>(&Array8[i * ElementSize]);
+		_mm_storeu_si128(
+			Vector, _mm_shuffle_epi8(_mm_loadu_si128(Vector), Shuffle)
+		);
+	}
+	return i;
+}
+
+// AVX-2
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX2
+inline std::size_t ByteswapAVX2(void* Array, std::size_t Count, std::size_t i)
+{
+	if( ElementSize == 1 || 16 % ElementSize )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	// Elements per 32-byte register
+	const std::size_t Width = ElementSize <= 16 ? 32 / ElementSize : 1;
+	const __m256i Shuffle = _mm256_broadcastsi128_si256(
+		ByteswapShuffle128<ElementSize>()
+	);
+	for( ; i + Width <= Count; i += Width )
+	{
+		__m256i* Vector = reinterpret_cast<__m256i*>(&Array8[i * ElementSize]);
+		_mm256_storeu_si256(
+			Vector, _mm256_shuffle_epi8(_mm256_loadu_si256(Vector), Shuffle)
+		);
+	}
+	return i;
+}
+
+// AVX-512BW/F
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX512
+inline std::size_t ByteswapAVX512(void* Array, std::size_t Count, std::size_t i)
+{
+	if( ElementSize == 1 || 16 % ElementSize )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	// Elements per 64-byte register
+	const std::size_t Width = ElementSize <= 16 ? 64 / ElementSize : 1;
+	const int Mask = static_cast<int>(ElementSize - 1);
+	// Each 32-bit word of the 16-byte lane shuffle, lowest byte first
+	const auto Word = [Mask](int k) -> int
+	{
+		return ((4 * k + 0) ^ Mask) | ((4 * k + 1) ^ Mask) << 8
+			| ((4 * k + 2) ^ Mask) << 16 | ((4 * k + 3) ^ Mask) << 24;
+	};
+	const __m512i Shuffle = _mm512_set4_epi32(Word(3), Word(2), Word(1), Word(0));
+	for( ; i + Width <= Count; i += Width )
+	{
+		__m512i* Vector = reinterpret_cast<__m512i*>(&Array8[i * ElementSize]);
+		_mm512_storeu_si512(
+			Vector, _mm512_shuffle_epi8(_mm512_loadu_si512(Vector), Shuffle)
+		);
+	}
+	return i;
+}
+#endif
+
+#if defined(QREVERSE_NEON)
+// NEON
+template< std::size_t ElementSize >
+inline std::size_t ByteswapNEON(void* Array, std::size_t Count, std::size_t i)
+{
+	if( ElementSize == 1 || 16 % ElementSize )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	// Elements per 16-byte register
+	const std::size_t Width = ElementSize <= 16 ? 16 / ElementSize : 1;
+	for( ; i + Width <= Count; i += Width )
+	{
+		const uint8x16_t Vector = vld1q_u8( &Array8[i * ElementSize] );
+		vst1q_u8(
+			&Array8[i * ElementSize],
+			ElementSize == 2 ? vrev16q_u8(Vector) :
+			ElementSize == 4 ? vrev32q_u8(Vector) :
+			ElementSize == 8 ? vrev64q_u8(Vector) :
+			RegisterReverse<1>::ReverseNEON(Vector)
+		);
+	}
+	return i;
+}
+#endif
+
+#if defined(QREVERSE_SVE)
+// SVE
+template< std::size_t ElementSize >
+inline std::size_t ByteswapSVE(void* Array, std::size_t Count, std::size_t i)
+{
+	if( ElementSize == 1 || 16 % ElementSize )
+	{
+		return i;
+	}
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	const std::size_t Size = Count * ElementSize;
+	const svuint8_t Shuffle = sveor_n_u8_x(
+		svptrue_b8(), svindex_u8(0, 1), static_cast<std::uint8_t>(ElementSize - 1)
+	);
+	// Registers hold a whole number of elements, so the predicated tail
+	// never splits one
+	for( std::size_t j = i * ElementSize; j < Size; j += svcntb() )
+	{
+		const svbool_t Mask = svwhilelt_b8_u64(j, Size);
+		svst1_u8(Mask, &Array8[j], svtbl_u8(svld1_u8(Mask, &Array8[j]), Shuffle));
+	}
+	return Count;
+}
+#endif
+
+// Number of leading elements to copy before the tail-to-head stores into Dst
+// land on VectorSize-aligned addresses. Returns Count when no amount of
+// peeling would align them or when the copy is too small to be worth
+// streaming.
+template< std::size_t ElementSize, std::size_t VectorSize >
+inline std::size_t StreamPeel(const void* Dst, std::size_t Count)
+{
+	if( Count * ElementSize < StreamThreshold() )
+	{
+		return Count;
+	}
+	const std::size_t Misalign = (
+		reinterpret_cast<std::uintptr_t>(Dst) + Count * ElementSize
+	) % VectorSize;
+	if( Misalign % ElementSize )
+	{
+		return Count;
+	}
+	return Misalign / ElementSize;
+}
+
+// Index from which the lower end of the range lands on VectorSize-aligned
+// addresses. Returns End when no amount of peeling would align it or when
+// less than a whole vector would be left to run aligned.
+template< std::size_t ElementSize, std::size_t VectorSize >
+inline std::size_t AlignPeel(const void* Array, std::size_t i, std::size_t End)
+{
+	const std::size_t Misalign = (
+		VectorSize - (
+			reinterpret_cast<std::uintptr_t>(Array) + i * ElementSize
+		) % VectorSize
+	) % VectorSize;
+	if( Misalign % ElementSize || (End - i) * ElementSize < Misalign + VectorSize )
+	{
+		return End;
+	}
+	return i + Misalign / ElementSize;
+}
+
+// Once the lower end is aligned the upper end moves in lockstep with it, so
+// whether it is aligned too only depends on where the array starts and ends
+template< std::size_t ElementSize, std::size_t VectorSize >
+inline Alignment PeelAlignment(
+	const void* Array, std::size_t Count, std::size_t i, std::size_t End
+)
+{
+	if( AlignPeel<ElementSize, VectorSize>(Array, i, End) == End )
+	{
+		return Alignment::None;
+	}
+	return (
+		2 * reinterpret_cast<std::uintptr_t>(Array) + Count * ElementSize
+	) % VectorSize ? Alignment::Lower : Alignment::Both;
+}
+
+/// Tier kernels
+// Each kernel runs its own tier first and then cascades down through every
+// narrower tier to finish off the middle of the array. Kernels are compiled
+// with the instruction set of their leading tier so that the narrower steps
+// inline into them.
+
+template< std::size_t ElementSize >
+void KernelSerial(
+	void* Array, std::size_t Count, std::size_t Begin, std::size_t End
+)
+{
+	ReverseSerial<ElementSize>(Array, Count, Begin, End);
+}
+
+template< std::size_t ElementSize >
+void KernelSwap(
+	void* Array, std::size_t Count, std::size_t Begin, std::size_t End
+)
+{
+	std::size_t i = Begin;
+	i = ReverseSwap<ElementSize>(Array, Count, i, End);
+	ReverseSerial<ElementSize>(Array, Count, i, End);
+}
+
+template< std::size_t ElementSize >
+void CopyKernelSerial(const void* Src, void* Dst, std::size_t Count)
+{
+	ReverseCopySerial<ElementSize>(Src, Dst, Count, 0, Count);
+}
+
+template< std::size_t ElementSize >
+void CopyKernelSwap(const void* Src, void* Dst, std::size_t Count)
+{
+	std::size_t i = 0;
+	i = ReverseCopySwap<ElementSize>(Src, Dst, Count, i);
+	ReverseCopySerial<ElementSize>(Src, Dst, Count, i, Count);
+}
+
+#if defined(QREVERSE_X86)
+template< std::size_t ElementSize >
+QREVERSE_TARGET_SSSE3
+void KernelSSSE3(
+	void* Array, std::size_t Count, std::size_t Begin, std::size_t End
+)
+{
+	std::size_t i = Begin;
+	i = ReverseSSSE3<ElementSize>(Array, Count, i, End);
+	i = ReverseSSSE3Overlap<ElementSize>(Array, Count, i, End);
+	i = ReverseWideSSSE3<ElementSize>(Array, Count, i, End);
+	i = ReverseSwap<ElementSize>(Array, Count, i, End);
+	ReverseSerial<ElementSize>(Array, Count, i, End);
+}
+
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX2
+void KernelAVX2(
+	void* Array, std::size_t Count, std::size_t Begin, std::size_t End
+)
+{
+	std::size_t i = Begin;
+	// Peel off elements with the narrower tiers until the lower end is aligned
+	const Alignment Align = PeelAlignment<ElementSize, 32>(Array, Count, i, End);
+	if( RegisterReverse<ElementSize>::AVX2 && Align != Alignment::None )
+	{
+		const std::size_t Peel = AlignPeel<ElementSize, 32>(Array, i, End);
+		i = ReverseSSSE3<ElementSize>(Array, Count, i, Peel);
+		i = ReverseSwap<ElementSize>(Array, Count, i, Peel);
+		i = ReverseSerial<ElementSize>(Array, Count, i, Peel);
+		if( Count * ElementSize >= PrefetchThreshold )
+		{
+			i = Align == Alignment::Both
+				? ReverseAVX2<ElementSize, Alignment::Both, true>(
+					Array, Count, i, End
+				)
+				: ReverseAVX2<ElementSize, Alignment::Lower, true>(
+					Array, Count, i, End
+				);
+		}
+		i = Align == Alignment::Both
+			? ReverseAVX2<ElementSize, Alignment::Both, false, UnrollCount>(
+				Array, Count, i, End
+			)
+			: ReverseAVX2<ElementSize, Alignment::Lower, false, UnrollCount>(
+				Array, Count, i, End
+			);
+		i = Align == Alignment::Both
+			? ReverseAVX2<ElementSize, Alignment::Both>(Array, Count, i, End)
+			: ReverseAVX2<ElementSize, Alignment::Lower>(Array, Count, i, End);
+	}
+	if( Count * ElementSize >= PrefetchThreshold )
+	{
+		i = ReverseAVX2<ElementSize, Alignment::None, true>(
+			Array, Count, i, End
+		);
+	}
+	i = ReverseAVX2<ElementSize, Alignment::None, false, UnrollCount>(
+		Array, Count, i, End
+	);
+	i = ReverseAVX2<ElementSize>(Array, Count, i, End);
+	i = ReverseAVX2Overlap<ElementSize>(Array, Count, i, End);
+	i = ReverseWideAVX2<ElementSize>(Array, Count, i, End);
+	i = ReverseSSSE3<ElementSize>(Array, Count, i, End);
+	i = ReverseSSSE3Overlap<ElementSize>(Array, Count, i, End);
+	i = ReverseWideSSSE3<ElementSize>(Array, Count, i, End);
+	i = ReverseSwap<ElementSize>(Array, Count, i, End);
+	ReverseSerial<ElementSize>(Array, Count, i, End);
+}
+
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX512
+void KernelAVX512(
+	void* Array, std::size_t Count, std::size_t Begin, std::size_t End
+)
+{
+	std::size_t i = Begin;
+	// Ranges shorter than a register are exchanged in one masked step
+	i = ReverseAVX512Masked<ElementSize>(Array, Count, i, End);
+	// Peel off elements with the narrower tiers until the lower end is aligned
+	const Alignment Align = PeelAlignment<ElementSize, 64>(Array, Count, i, End);
+	if( RegisterReverse<ElementSize>::AVX512 && Align != Alignment::None )
+	{
+		const std::size_t Peel = AlignPeel<ElementSize, 64>(Array, i, End);
+		i = ReverseAVX2<ElementSize>(Array, Count, i, Peel);
+		i = ReverseSSSE3<ElementSize>(Array, Count, i, Peel);
+		i = ReverseSwap<ElementSize>(Array, Count, i, Peel);
+		i = ReverseSerial<ElementSize>(Array, Count, i, Peel);
+		if( Count * ElementSize >= PrefetchThreshold )
+		{
+			i = Align == Alignment::Both
+				? ReverseAVX512<ElementSize, Alignment::Both, true>(
+					Array, Count, i, End
+				)
+				: ReverseAVX512<ElementSize, Alignment::Lower, true>(
+					Array, Count, i, End
+				);
+		}
+		i = Align == Alignment::Both
+			? ReverseAVX512<ElementSize, Alignment::Both, false, UnrollCount>(
+				Array, Count, i, End
+			)
+			: ReverseAVX512<ElementSize, Alignment::Lower, false, UnrollCount>(
+				Array, Count, i, End
+			);
+		i = Align == Alignment::Both
+			? ReverseAVX512<ElementSize, Alignment::Both>(Array, Count, i, End)
+			: ReverseAVX512<ElementSize, Alignment::Lower>(Array, Count, i, End);
+	}
+	if( Count * ElementSize >= PrefetchThreshold )
+	{
+		i = ReverseAVX512<ElementSize, Alignment::None, true>(
+			Array, Count, i, End
+		);
+	}
+	i = ReverseAVX512<ElementSize, Alignment::None, false, UnrollCount>(
+		Array, Count, i, End
+	);
+	i = ReverseAVX512<ElementSize>(Array, Count, i, End);
+	i = ReverseAVX512Overlap<ElementSize>(Array, Count, i, End);
+	i = ReverseWideAVX512<ElementSize>(Array, Count, i, End);
+	i = ReverseAVX2<ElementSize>(Array, Count, i, End);
+	i = ReverseAVX2Overlap<ElementSize>(Array, Count, i, End);
+	i = ReverseWideAVX2<ElementSize>(Array, Count, i, End);
+	i = ReverseSSSE3<ElementSize>(Array, Count, i, End);
+	i = ReverseSSSE3Overlap<ElementSize>(Array, Count, i, End);
+	i = ReverseWideSSSE3<ElementSize>(Array, Count, i, End);
+	i = ReverseSwap<ElementSize>(Array, Count, i, End);
+	ReverseSerial<ElementSize>(Array, Count, i, End);
+}
+
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX512VBMI
+void KernelAVX512VBMI(
+	void* Array, std::size_t Count, std::size_t Begin, std::size_t End
+)
+{
+	std::size_t i = Begin;
+	i = ReverseAVX512VBMI<ElementSize>(Array, Count, i, End);
+	KernelAVX512<ElementSize>(Array, Count, i, End);
+}
+
+template< std::size_t ElementSize >
+QREVERSE_TARGET_SSSE3
+void CopyKernelSSSE3(const void* Src, void* Dst, std::size_t Count)
+{
+	std::size_t i = 0;
+	const std::size_t Peel = StreamPeel<ElementSize, 16>(Dst, Count);
+	if( Peel < Count )
+	{
+		i = ReverseCopySerial<ElementSize>(Src, Dst, Count, i, Peel);
+		i = ReverseCopySSSE3<ElementSize, true>(Src, Dst, Count, i);
+		_mm_sfence();
+	}
+	i = ReverseCopySSSE3<ElementSize, false>(Src, Dst, Count, i);
+	i = ReverseCopySwap<ElementSize>(Src, Dst, Count, i);
+	ReverseCopySerial<ElementSize>(Src, Dst, Count, i, Count);
+}
+
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX2
+void CopyKernelAVX2(const void* Src, void* Dst, std::size_t Count)
+{
+	std::size_t i = 0;
+	const std::size_t Peel = StreamPeel<ElementSize, 32>(Dst, Count);
+	if( Peel < Count )
+	{
+		i = ReverseCopySerial<ElementSize>(Src, Dst, Count, i, Peel);
+		i = ReverseCopyAVX2<ElementSize, true>(Src, Dst, Count, i);
+		_mm_sfence();
+	}
+	i = ReverseCopyAVX2<ElementSize, false>(Src, Dst, Count, i);
+	i = ReverseCopySSSE3<ElementSize, false>(Src, Dst, Count, i);
+	i = ReverseCopySwap<ElementSize>(Src, Dst, Count, i);
+	ReverseCopySerial<ElementSize>(Src, Dst, Count, i, Count);
+}
+
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX512
+void CopyKernelAVX512(const void* Src, void* Dst, std::size_t Count)
+{
+	std::size_t i = 0;
+	const std::size_t Peel = StreamPeel<ElementSize, 64>(Dst, Count);
+	if( Peel < Count )
+	{
+		i = ReverseCopySerial<ElementSize>(Src, Dst, Count, i, Peel);
+		i = ReverseCopyAVX512<ElementSize, true>(Src, Dst, Count, i);
+		_mm_sfence();
+	}
+	i = ReverseCopyAVX512<ElementSize, false>(Src, Dst, Count, i);
+	i = ReverseCopyAVX2<ElementSize, false>(Src, Dst, Count, i);
+	i = ReverseCopySSSE3<ElementSize, false>(Src, Dst, Count, i);
+	i = ReverseCopySwap<ElementSize>(Src, Dst, Count, i);
+	ReverseCopySerial<ElementSize>(Src, Dst, Count, i, Count);
+}
+#endif
+
+#if defined(QREVERSE_NEON)
+template< std::size_t ElementSize >
+void KernelNEON(
+	void* Array, std::size_t Count, std::size_t Begin, std::size_t End
+)
+{
+	std::size_t i = Begin;
+	if( Count * ElementSize >= PrefetchThreshold )
+	{
+		i = ReverseNEON<ElementSize, true>(Array, Count, i, End);
+	}
+	i = ReverseNEON<ElementSize>(Array, Count, i, End);
+	i = ReverseNEONOverlap<ElementSize>(Array, Count, i, End);
+	i = ReverseWideNEON<ElementSize>(Array, Count, i, End);
+	i = ReverseSwap<ElementSize>(Array, Count, i, End);
+	ReverseSerial<ElementSize>(Array, Count, i, End);
+}
+
+template< std::size_t ElementSize >
+void CopyKernelNEON(const void* Src, void* Dst, std::size_t Count)
+{
+	std::size_t i = 0;
+	i = ReverseCopyNEON<ElementSize>(Src, Dst, Count, i);
+	i = ReverseCopySwap<ElementSize>(Src, Dst, Count, i);
+	ReverseCopySerial<ElementSize>(Src, Dst, Count, i, Count);
+}
+#endif
+
+#if defined(QREVERSE_SVE)
+template< std::size_t ElementSize >
+void KernelSVE(
+	void* Array, std::size_t Count, std::size_t Begin, std::size_t End
+)
+{
+	std::size_t i = Begin;
+	i = ReverseSVE<ElementSize>(Array, Count, i, End);
+	i = ReverseNEON<ElementSize>(Array, Count, i, End);
+	i = ReverseWideNEON<ElementSize>(Array, Count, i, End);
+	i = ReverseSwap<ElementSize>(Array, Count, i, End);
+	ReverseSerial<ElementSize>(Array, Count, i, End);
+}
+
+template< std::size_t ElementSize >
+void CopyKernelSVE(const void* Src, void* Dst, std::size_t Count)
+{
+	std::size_t i = 0;
+	i = ReverseCopySVE<ElementSize>(Src, Dst, Count, i);
+	i = ReverseCopyNEON<ElementSize>(Src, Dst, Count, i);
+	i = ReverseCopySwap<ElementSize>(Src, Dst, Count, i);
+	ReverseCopySerial<ElementSize>(Src, Dst, Count, i, Count);
+}
+#endif
+
+template< std::size_t ElementSize >
+void ByteswapKernelSerial(void* Array, std::size_t Count)
+{
+	ByteswapSerial<ElementSize>(Array, Count, 0);
+}
+
+template< std::size_t ElementSize >
+void ByteswapKernelSwap(void* Array, std::size_t Count)
+{
+	std::size_t i = 0;
+	i = ByteswapSwap<ElementSize>(Array, Count, i);
+	ByteswapSerial<ElementSize>(Array, Count, i);
+}
+
+#if defined(QREVERSE_X86)
+template< std::size_t ElementSize >
+QREVERSE_TARGET_SSSE3
+void ByteswapKernelSSSE3(void* Array, std::size_t Count)
+{
+	std::size_t i = 0;
+	i = ByteswapSSSE3<ElementSize>(Array, Count, i);
+	i = ByteswapSwap<ElementSize>(Array, Count, i);
+	ByteswapSerial<ElementSize>(Array, Count, i);
+}
+
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX2
+void ByteswapKernelAVX2(void* Array, std::size_t Count)
+{
+	std::size_t i = 0;
+	i = ByteswapAVX2<ElementSize>(Array, Count, i);
+	i = ByteswapSSSE3<ElementSize>(Array, Count, i);
+	i = ByteswapSwap<ElementSize>(Array, Count, i);
+	ByteswapSerial<ElementSize>(Array, Count, i);
+}
+
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX512
+void ByteswapKernelAVX512(void* Array, std::size_t Count)
+{
+	std::size_t i = 0;
+	i = ByteswapAVX512<ElementSize>(Array, Count, i);
+	i = ByteswapAVX2<ElementSize>(Array, Count, i);
+	i = ByteswapSSSE3<ElementSize>(Array, Count, i);
+	i = ByteswapSwap<ElementSize>(Array, Count, i);
+	ByteswapSerial<ElementSize>(Array, Count, i);
+}
+#endif
+
+#if defined(QREVERSE_NEON)
+template< std::size_t ElementSize >
+void ByteswapKernelNEON(void* Array, std::size_t Count)
+{
+	std::size_t i = 0;
+	i = ByteswapNEON<ElementSize>(Array, Count, i);
+	i = ByteswapSwap<ElementSize>(Array, Count, i);
+	ByteswapSerial<ElementSize>(Array, Count, i);
+}
+#endif
+
+#if defined(QREVERSE_SVE)
+template< std::size_t ElementSize >
+void ByteswapKernelSVE(void* Array, std::size_t Count)
+{
+	std::size_t i = 0;
+	i = ByteswapSVE<ElementSize>(Array, Count, i);
+	i = ByteswapNEON<ElementSize>(Array, Count, i);
+	i = ByteswapSwap<ElementSize>(Array, Count, i);
+	ByteswapSerial<ElementSize>(Array, Count, i);
+}
+#endif
+
+} // namespace detail
+
+// Returns true if the running processor is able to execute the tier
+inline bool TierSupported(Tier Level)
+{
+	// Probed once upon first use
+	static const std::uint32_t Tiers = detail::ProbeTiers();
+	return (Tiers >> static_cast<std::uint32_t>(Level)) & 1u;
+}
+
+// The widest tier that the running processor is able to execute
+inline Tier HighestTier()
+{
+	for(
+		std::uint32_t Level = static_cast<std::uint32_t>(Tier::Count);
+		Level-- > 0;
+	)
+	{
+		if( TierSupported(static_cast<Tier>(Level)) )
+		{
+			return static_cast<Tier>(Level);
+		}
+	}
+	return Tier::Serial;
+}
+
+// What the steps of one tier have done, see QREVERSE_STATS
+struct TierStats
+{
+	// Calls that moved any elements
+	std::uint64_t Calls = 0;
+	// Elements moved, each element of an exchanged pair counting once
+	std::uint64_t Elements = 0;
+	std::uint64_t Ticks = 0;
+};
+
+struct ReverseStats
+{
+	TierStats Tiers[static_cast<std::size_t>(Tier::Count)];
+};
+
+// Totals of the steps for ElementSize-byte elements so far, of reversals as
+// well as reverse-copies. All zeroes unless built with QREVERSE_STATS.
+template< std::size_t ElementSize >
+inline ReverseStats GetReverseStats()
+{
+	ReverseStats Stats;
+#if defined(QREVERSE_STATS)
+	const detail::StepCounters* Counters = detail::StatsCounters<ElementSize>();
+	for(
+		std::size_t Level = 0; Level < static_cast<std::size_t>(Tier::Count);
+		++Level
+	)
+	{
+		Stats.Tiers[Level].Calls = Counters[Level].Calls.load();
+		Stats.Tiers[Level].Elements = Counters[Level].Elements.load();
+		Stats.Tiers[Level].Ticks = Counters[Level].Ticks.load();
+	}
+#endif
+	return Stats;
+}
+
+template< std::size_t ElementSize >
+inline void ResetReverseStats()
+{
+#if defined(QREVERSE_STATS)
+	detail::StepCounters* Counters = detail::StatsCounters<ElementSize>();
+	for(
+		std::size_t Level = 0; Level < static_cast<std::size_t>(Tier::Count);
+		++Level
+	)
+	{
+		Counters[Level].Calls = 0;
+		Counters[Level].Elements = 0;
+		Counters[Level].Ticks = 0;
+	}
+#endif
+}
+
+// Returns the kernel that leads with the specified tier, or nullptr if that
+// tier is not available in this build or on this processor
+template< std::size_t ElementSize >
+inline ReverseProc GetReverseProc(Tier Level)
+{
+	static const ReverseProc Procs[static_cast<std::size_t>(Tier::Count)] = {
+		detail::KernelSerial<ElementSize>,
+		detail::KernelSwap<ElementSize>,
+#if defined(QREVERSE_X86)
+		detail::KernelSSSE3<ElementSize>,
+#else
+		nullptr,
+#endif
+#if defined(QREVERSE_NEON)
+		detail::KernelNEON<ElementSize>,
+#else
+		nullptr,
+#endif
+#if defined(QREVERSE_X86)
+		detail::KernelAVX2<ElementSize>,
+		detail::KernelAVX512<ElementSize>,
+		detail::KernelAVX512VBMI<ElementSize>,
+#else
+		nullptr,
+		nullptr,
+		nullptr,
+#endif
+#if defined(QREVERSE_SVE)
+		detail::KernelSVE<ElementSize>,
+#else
+		nullptr,
+#endif
+	};
+	if( Level >= Tier::Count || !TierSupported(Level) )
+	{
+		return nullptr;
+	}
+	return Procs[static_cast<std::size_t>(Level)];
+}
+
+template< std::size_t ElementSize >
+inline ReverseCopyProc GetReverseCopyProc(Tier Level)
+{
+	static const ReverseCopyProc Procs[static_cast<std::size_t>(Tier::Count)] = {
+		detail::CopyKernelSerial<ElementSize>,
+		detail::CopyKernelSwap<ElementSize>,
+#if defined(QREVERSE_X86)
+		detail::CopyKernelSSSE3<ElementSize>,
+#else
+		nullptr,
+#endif
+#if defined(QREVERSE_NEON)
+		detail::CopyKernelNEON<ElementSize>,
+#else
+		nullptr,
+#endif
+#if defined(QREVERSE_X86)
+		detail::CopyKernelAVX2<ElementSize>,
+		detail::CopyKernelAVX512<ElementSize>,
+		// No reverse-copy step makes use of VBMI yet
+		detail::CopyKernelAVX512<ElementSize>,
+#else
+		nullptr,
+		nullptr,
+		nullptr,
+#endif
+#if defined(QREVERSE_SVE)
+		detail::CopyKernelSVE<ElementSize>,
+#else
+		nullptr,
+#endif
+	};
+	if( Level >= Tier::Count || !TierSupported(Level) )
+	{
+		return nullptr;
+	}
+	return Procs[static_cast<std::size_t>(Level)];
+}
+
+template< std::size_t ElementSize >
+inline ByteswapProc GetByteswapProc(Tier Level)
+{
+	static const ByteswapProc Procs[static_cast<std::size_t>(Tier::Count)] = {
+		detail::ByteswapKernelSerial<ElementSize>,
+		detail::ByteswapKernelSwap<ElementSize>,
+#if defined(QREVERSE_X86)
+		detail::ByteswapKernelSSSE3<ElementSize>,
+#else
+		nullptr,
+#endif
+#if defined(QREVERSE_NEON)
+		detail::ByteswapKernelNEON<ElementSize>,
+#else
+		nullptr,
+#endif
+#if defined(QREVERSE_X86)
+		detail::ByteswapKernelAVX2<ElementSize>,
+		detail::ByteswapKernelAVX512<ElementSize>,
+		// Byteswapping is an in-lane shuffle that VBMI has nothing to add to
+		detail::ByteswapKernelAVX512<ElementSize>,
+#else
+		nullptr,
+		nullptr,
+		nullptr,
+#endif
+#if defined(QREVERSE_SVE)
+		detail::ByteswapKernelSVE<ElementSize>,
+#else
+		nullptr,
+#endif
+	};
+	if( Level >= Tier::Count || !TierSupported(Level) )
+	{
+		return nullptr;
+	}
+	return Procs[static_cast<std::size_t>(Level)];
+}
+
+// The alignment case that the kernel leading with the specified tier runs
+// when reversing the whole of Array
+template< std::size_t ElementSize >
+inline Alignment GetAlignment(Tier Level, const void* Array, std::size_t Count)
+{
+	switch( Level )
+	{
+	case Tier::AVX2:
+		return detail::RegisterReverse<ElementSize>::AVX2
+			? detail::PeelAlignment<ElementSize, 32>(Array, Count, 0, Count / 2)
+			: Alignment::None;
+	case Tier::AVX512:
+	case Tier::AVX512VBMI:
+		return detail::RegisterReverse<ElementSize>::AVX512
+			? detail::PeelAlignment<ElementSize, 64>(Array, Count, 0, Count / 2)
+			: Alignment::None;
+	default:
+		return Alignment::None;
+	}
+}
+
+// The fastest kernel for this processor, selected upon first use
+template< std::size_t ElementSize >
+inline ReverseProc SelectReverseProc()
+{
+	static const ReverseProc Proc = GetReverseProc<ElementSize>(HighestTier());
+	return Proc;
+}
+
+template< std::size_t ElementSize >
+inline ReverseCopyProc SelectReverseCopyProc()
+{
+	static const ReverseCopyProc Proc =
+		GetReverseCopyProc<ElementSize>(HighestTier());
+	return Proc;
+}
+
+template< std::size_t ElementSize >
+inline ByteswapProc SelectByteswapProc()
+{
+	static const ByteswapProc Proc = GetByteswapProc<ElementSize>(HighestTier());
+	return Proc;
+}
+
+} // namespace qreverse
+
+template< std::size_t ElementSize >
+inline void qReverse(void* Array, std::size_t Count)
+{
+	qreverse::SelectReverseProc<ElementSize>()(Array, Count, 0, Count / 2);
+}
+
+// Writes the Count elements of Src into Dst in reverse order in a single
+// pass. Src and Dst must not overlap. Destinations larger than the last-level
+// cache are written with non-temporal stores.
+template< std::size_t ElementSize >
+inline void qReverseCopy(const void* Src, void* Dst, std::size_t Count)
+{
+	qreverse::SelectReverseCopyProc<ElementSize>()(Src, Dst, Count);
+}
+
+// Reverses the elements [First, Last) of a larger array in-place
+template< std::size_t ElementSize >
+inline void qReverseRange(void* Array, std::size_t First, std::size_t Last)
+{
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	qReverse<ElementSize>(&Array8[First * ElementSize], Last - First);
+}
+
+// Rotates the array to the left in-place such that the element at Shift ends
+// up first, the same as std::rotate(Array, Array + Shift, Array + Count)
+template< std::size_t ElementSize >
+inline void qRotate(void* Array, std::size_t Count, std::size_t Shift)
+{
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	Shift = Count ? Shift % Count : 0;
+	if( Shift == 0 )
+	{
+		return;
+	}
+
+	// When either side fits on the stack it is set aside while the other is
+	// moved over, touching every element once rather than twice
+	const std::size_t StageSize = 4096;
+	std::uint8_t Stage[StageSize];
+	const std::size_t HeadSize = Shift * ElementSize;
+	const std::size_t TailSize = (Count - Shift) * ElementSize;
+	if( HeadSize <= StageSize )
+	{
+		std::memcpy(Stage, Array8, HeadSize);
+		std::memmove(Array8, &Array8[HeadSize], TailSize);
+		std::memcpy(&Array8[TailSize], Stage, HeadSize);
+		return;
+	}
+	if( TailSize <= StageSize )
+	{
+		std::memcpy(Stage, &Array8[HeadSize], TailSize);
+		std::memmove(&Array8[TailSize], Array8, HeadSize);
+		std::memcpy(Array8, Stage, TailSize);
+		return;
+	}
+
+	// Otherwise a rotation is the reversal of both sides followed by the
+	// reversal of the whole
+	qReverseRange<ElementSize>(Array, 0, Shift);
+	qReverseRange<ElementSize>(Array, Shift, Count);
+	qReverse<ElementSize>(Array, Count);
+}
+
+// Reverses the order of the bytes within each element while leaving the
+// elements themselves in place, such as to convert between little and
+// big-endian samples
+template< std::size_t ElementSize >
+inline void qByteswap(void* Array, std::size_t Count)
+{
+	qreverse::SelectByteswapProc<ElementSize>()(Array, Count);
+}
+
+// Reverses the order of the elements as well as the bytes within each of
+// them. Both together are the reversal of every byte of the array, which is
+// exactly what the one byte kernels already do with one shuffle per register.
+template< std::size_t ElementSize >
+inline void qReverseByteswap(void* Array, std::size_t Count)
+{
+	qReverse<1>(Array, Count * ElementSize);
+}
@@ -0,0 +1,367 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <qreverse.hpp>
+
+namespace qreverse
+{
+
+// Calls are grouped into buckets by the position of the highest set bit of
+// their element count, so bucket b covers the counts [2^b, 2^(b+1))
+constexpr std::size_t PlanBuckets = 48;
+
+// Largest array, in bytes, that calibration measures. Larger buckets are past
+// the caches and are left to the highest tier, the only one that prefetches.
+constexpr std::size_t CalibrationMaxSize = 8u * 1024u * 1024u;
+
+// Environment variable naming the file that the default plans are loaded
+// from, and saved to after calibrating when the file had none
+constexpr const char* PlanCacheVariable = "QREVERSE_PLAN_CACHE";
+
+// The tier that leads the reversal of each size bucket of one element size
+struct ReversePlan
+{
+	Tier Tiers[PlanBuckets];
+};
+
+namespace detail
+{
+
+inline std::size_t SizeBucket(std::size_t Count)
+{
+	std::size_t Bucket = 0;
+	while( Count >>= 1 )
+	{
+		++Bucket;
+	}
+	return Bucket < PlanBuckets ? Bucket : PlanBuckets - 1;
+}
+
+// Tiers supported by the running processor as a mask of their bits. A plan is
+// only valid on processors with the same mask.
+inline std::uint32_t SupportedTiers()
+{
+	std::uint32_t Mask = 0;
+	for(
+		std::size_t Level = 0; Level < static_cast<std::size_t>(Tier::Count);
+		++Level
+	)
+	{
+		if(
+			TierSupported(static_cast<Tier>(Level))
+			&& GetReverseProc<1>(static_cast<Tier>(Level))
+		)
+		{
+			Mask |= 1u << Level;
+		}
+	}
+	return Mask;
+}
+
+// Fastest of several batches of reversals, in nanoseconds per call. Each batch
+// runs long enough for the clock overhead to vanish.
+inline double TimeReverse(
+	ReverseProc Reverse, void* Array, std::size_t Count, std::size_t ElementSize
+)
+{
+	using Clock = std::chrono::steady_clock;
+	const std::size_t Bytes = Count * ElementSize;
+	const std::size_t Calls = Bytes < 64u * 1024u ? (64u * 1024u) / Bytes : 1;
+	double Fastest = 0.0;
+	for( std::size_t Trial = 0; Trial < 5; ++Trial )
+	{
+		const Clock::time_point Start = Clock::now();
+		for( std::size_t i = 0; i < Calls; ++i )
+		{
+			Reverse(Array, Count, 0, Count / 2);
+		}
+		const double Time = std::chrono::duration<double, std::nano>(
+			Clock::now() - Start
+		).count() / Calls;
+		if( !Trial || Time < Fastest )
+		{
+			Fastest = Time;
+		}
+	}
+	return Fastest;
+}
+
+template< std::size_t ElementSize >
+struct PlanTable
+{
+	std::atomic<ReverseProc> Procs[PlanBuckets];
+	// Whether a plan has been set, either the default one or one of the
+	// caller's
+	std::atomic<bool> Planned{false};
+	std::mutex Lock;
+
+	void Set(const ReversePlan& Plan)
+	{
+		for( std::size_t Bucket = 0; Bucket < PlanBuckets; ++Bucket )
+		{
+			ReverseProc Proc = GetReverseProc<ElementSize>(Plan.Tiers[Bucket]);
+			Procs[Bucket].store(
+				Proc ? Proc : SelectReverseProc<ElementSize>(),
+				std::memory_order_relaxed
+			);
+		}
+		Planned.store(true, std::memory_order_release);
+	}
+};
+
+template< std::size_t ElementSize >
+inline PlanTable<ElementSize>& GetPlanTable()
+{
+	static PlanTable<ElementSize> Table;
+	return Table;
+}
+
+} // namespace detail
+
+// Measures every tier that the running processor supports at a count near the
+// middle of each size bucket, and never past its top, and picks the fastest
+// one for each. Bucket 0 only holds arrays of a single element, which leave
+// nothing to exchange, and is measured with a pair. Takes about 30 to 150
+// milliseconds with the default MaxSize, the most for the smallest elements.
+template< std::size_t ElementSize >
+inline ReversePlan CalibrateReversePlan(
+	std::size_t MaxSize = CalibrationMaxSize
+)
+{
+	ReversePlan Plan;
+	const std::size_t MaxCount = MaxSize / ElementSize
+		? MaxSize / ElementSize : 1;
+	std::vector<std::uint8_t> Array(
+		ElementSize * (MaxCount + MaxCount / 2 + 2)
+	);
+	for( std::size_t Bucket = 0; Bucket < PlanBuckets; ++Bucket )
+	{
+		Plan.Tiers[Bucket] = HighestTier();
+		const std::size_t Lowest = std::size_t(1) << Bucket;
+		if( Lowest > MaxCount )
+		{
+			continue;
+		}
+		// Tiers only differ once there is a pair to exchange, and a count past
+		// the top of the bucket would pick the tier of the next bucket up
+		const std::size_t Count = std::max<std::size_t>(
+			2, std::min(Lowest + Lowest / 2 + 1, 2 * Lowest - 1)
+		);
+		double FastestTime = 0.0;
+		// From the highest tier down, a lower tier has to be clearly faster to
+		// be chosen so that noise between tiers that tie, such as once the
+		// array is bound by memory, keeps to the widest one
+		for(
+			std::size_t Level = static_cast<std::size_t>(Tier::Count); Level-- > 0;
+		)
+		{
+			const ReverseProc Reverse =
+				GetReverseProc<ElementSize>(static_cast<Tier>(Level));
+			if( !Reverse )
+			{
+				continue;
+			}
+			const double Time = detail::TimeReverse(
+				Reverse, Array.data(), Count, ElementSize
+			);
+			if( !FastestTime || Time < FastestTime * 0.95 )
+			{
+				Plan.Tiers[Bucket] = static_cast<Tier>(Level);
+				FastestTime = Time;
+			}
+		}
+	}
+	return Plan;
+}
+
+// Reads the plan for ElementSize-byte elements out of a plan cache file.
+// Returns false if the file has none, or none that was calibrated on a
+// processor supporting the same tiers.
+template< std::size_t ElementSize >
+inline bool LoadReversePlan(const char* Path, ReversePlan& Plan)
+{
+	std::FILE* File = std::fopen(Path, "r");
+	if( !File )
+	{
+		return false;
+	}
+	const std::uint32_t Mask = detail::SupportedTiers();
+	bool Found = false;
+	char Line[512];
+	while( !Found && std::fgets(Line, sizeof(Line), File) )
+	{
+		// Each line holds one element size:
+		// qreverse-plan <ElementSize> <Tier mask> <Tier of each bucket...>
+		char* Cursor = Line;
+		if( std::strncmp(Cursor, "qreverse-plan ", 14) )
+		{
+			continue;
+		}
+		Cursor += 14;
+		if(
+			std::strtoull(Cursor, &Cursor, 10) != ElementSize
+			|| std::strtoul(Cursor, &Cursor, 16) != Mask
+		)
+		{
+			continue;
+		}
+		Found = true;
+		for( std::size_t Bucket = 0; Found && Bucket < PlanBuckets; ++Bucket )
+		{
+			char* Next = Cursor;
+			const unsigned long Level = std::strtoul(Cursor, &Next, 10);
+			Found = Next != Cursor
+				&& Level < static_cast<unsigned long>(Tier::Count)
+				&& ((Mask >> Level) & 1u);
+			Plan.Tiers[Bucket] = static_cast<Tier>(Level);
+			Cursor = Next;
+		}
+	}
+	std::fclose(File);
+	return Found;
+}
+
+// Writes the plan for ElementSize-byte elements to a plan cache file, keeping
+// the plans of the other element sizes that it already holds
+template< std::size_t ElementSize >
+inline bool SaveReversePlan(const char* Path, const ReversePlan& Plan)
+{
+	std::string Contents;
+	if( std::FILE* File = std::fopen(Path, "r") )
+	{
+		const std::string Own =
+			"qreverse-plan " + std::to_string(ElementSize) + " ";
+		char Line[512];
+		while( std::fgets(Line, sizeof(Line), File) )
+		{
+			if( std::strncmp(Line, Own.c_str(), Own.size()) )
+			{
+				Contents += Line;
+			}
+		}
+		std::fclose(File);
+	}
+	char Mask[16];
+	std::snprintf(
+		Mask, sizeof(Mask), "%x",
+		static_cast<unsigned int>(detail::SupportedTiers())
+	);
+	Contents += "qreverse-plan " + std::to_string(ElementSize) + " " + Mask;
+	for( std::size_t Bucket = 0; Bucket < PlanBuckets; ++Bucket )
+	{
+		Contents += " ";
+		Contents += std::to_string(static_cast<unsigned>(Plan.Tiers[Bucket]));
+	}
+	Contents += "\n";
+
+	std::FILE* File = std::fopen(Path, "w");
+	if( !File )
+	{
+		return false;
+	}
+	const bool Written =
+		std::fwrite(Contents.data(), 1, Contents.size(), File) == Contents.size();
+	return (std::fclose(File) == 0) && Written;
+}
+
+// Replaces the plan that qReverseAdaptive follows for ElementSize-byte
+// elements, such as with a fresh calibration under the current load. Tiers
+// that are unavailable fall back to the highest tier. Setting a plan before
+// the first call to qReverseAdaptive skips the default one.
+template< std::size_t ElementSize >
+inline void SetReversePlan(const ReversePlan& Plan)
+{
+	detail::PlanTable<ElementSize>& Table = detail::GetPlanTable<ElementSize>();
+	const std::lock_guard<std::mutex> Guard(Table.Lock);
+	Table.Set(Plan);
+}
+
+// The plan that qReverseAdaptive currently follows
+template< std::size_t ElementSize >
+inline ReversePlan GetReversePlan()
+{
+	ReversePlan Plan;
+	detail::PlanTable<ElementSize>& Table = detail::GetPlanTable<ElementSize>();
+	for( std::size_t Bucket = 0; Bucket < PlanBuckets; ++Bucket )
+	{
+		const ReverseProc Proc = Table.Procs[Bucket].load(
+			std::memory_order_relaxed
+		);
+		Plan.Tiers[Bucket] = HighestTier();
+		for(
+			std::size_t Level = 0;
+			Level < static_cast<std::size_t>(Tier::Count); ++Level
+		)
+		{
+			if(
+				Proc
+				&& GetReverseProc<ElementSize>(static_cast<Tier>(Level)) == Proc
+			)
+			{
+				Plan.Tiers[Bucket] = static_cast<Tier>(Level);
+				break;
+			}
+		}
+	}
+	return Plan;
+}
+
+namespace detail
+{
+
+// The default plan comes from the cache file named by PlanCacheVariable when
+// it has one for this processor. Otherwise it is calibrated once, and saved
+// there for the next process to start.
+template< std::size_t ElementSize >
+inline void SetDefaultPlan(PlanTable<ElementSize>& Table)
+{
+	const std::lock_guard<std::mutex> Guard(Table.Lock);
+	if( Table.Planned.load(std::memory_order_relaxed) )
+	{
+		return;
+	}
+	ReversePlan Plan;
+	const char* Path = std::getenv(PlanCacheVariable);
+	if( !Path || !*Path || !LoadReversePlan<ElementSize>(Path, Plan) )
+	{
+		Plan = CalibrateReversePlan<ElementSize>();
+		if( Path && *Path )
+		{
+			SaveReversePlan<ElementSize>(Path, Plan);
+		}
+	}
+	Table.Set(Plan);
+}
+
+} // namespace detail
+
+} // namespace qreverse
+
+// Reverses the array with the tier that the plan for its size bucket measured
+// to be the fastest, rather than always leading with the highest tier. The
+// first call for each element size loads or calibrates the plan.
+template< std::size_t ElementSize >
+inline void qReverseAdaptive(void* Array, std::size_t Count)
+{
+	qreverse::detail::PlanTable<ElementSize>& Table =
+		qreverse::detail::GetPlanTable<ElementSize>();
+	if( !Table.Planned.load(std::memory_order_acquire) )
+	{
+		qreverse::detail::SetDefaultPlan<ElementSize>(Table);
+	}
+	const qreverse::ReverseProc Reverse = Table.Procs[
+		qreverse::detail::SizeBucket(Count)
+	].load(std::memory_order_relaxed);
+	Reverse(Array, Count, 0, Count / 2);
+}
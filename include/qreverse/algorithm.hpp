@@ -0,0 +1,76 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+#include <algorithm>
+#include <type_traits>
+
+#include <qreverse.hpp>
+
+namespace qreverse
+{
+
+namespace detail
+{
+
+// Trivially copyable elements can be moved around as raw bytes
+template< typename T >
+inline void TypedReverse(T* First, T* Last, std::true_type)
+{
+	qReverse<sizeof(T)>(First, static_cast<std::size_t>(Last - First));
+}
+
+// Anything else goes through std::reverse so that its own move constructor
+// and assignment operators are used
+template< typename T >
+inline void TypedReverse(T* First, T* Last, std::false_type)
+{
+	std::reverse(First, Last);
+}
+
+} // namespace detail
+
+// Drop-in replacement for std::reverse over contiguous storage. Reverses
+// [First, Last) with the qReverse kernel of the matching element size when T
+// is trivially copyable and with std::reverse otherwise.
+template< typename T >
+inline void reverse(T* First, T* Last)
+{
+	static_assert(
+		!std::is_const<T>::value, "Unable to reverse an array of const elements"
+	);
+	detail::TypedReverse(
+		First, Last,
+		std::integral_constant<
+			bool, std::is_trivially_copyable<T>::value
+		>()
+	);
+}
+
+// Fixed-size arrays
+template< typename T, std::size_t Count >
+inline void reverse(T (&Array)[Count])
+{
+	qreverse::reverse(Array, Array + Count);
+}
+
+// Contiguous containers providing data() and size(), such as std::vector,
+// std::array, and std::basic_string
+template< typename Container >
+inline auto reverse(Container& Range)
+	-> decltype(Range.data(), &Range[0] + Range.size(), void())
+{
+	static_assert(
+		!std::is_const<Container>::value, "Unable to reverse a const container"
+	);
+	if( Range.size() == 0 )
+	{
+		return;
+	}
+	// Prior to C++17 std::basic_string only hands out a const data(), while
+	// the element at its front is writable in every standard
+	auto* First = &Range[0];
+	qreverse::reverse(First, First + Range.size());
+}
+
+} // namespace qreverse
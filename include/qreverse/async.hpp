@@ -0,0 +1,189 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+
+#include <qreverse.hpp>
+#include <qreverse/parallel.hpp>
+
+namespace qreverse
+{
+
+// Called once an asynchronous reversal is over, before its future becomes
+// ready, with whether every chunk was reversed rather than it having been
+// cancelled part-way
+using ReverseCallback = std::function<void(bool Completed)>;
+
+namespace detail
+{
+
+// Shared between a handle and the workers running its chunks
+struct AsyncReverseState
+{
+	std::atomic<std::size_t> Next{0};
+	std::atomic<std::size_t> Done{0};
+	std::atomic<std::size_t> Active{0};
+	std::atomic<bool> Cancelled{false};
+	std::size_t ChunkCount = 0;
+	std::promise<bool> Promise;
+	ReverseCallback Callback;
+
+	// Whoever finishes last reports the outcome
+	void Finish()
+	{
+		const bool Completed = Done.load() == ChunkCount;
+		if( Callback )
+		{
+			Callback(Completed);
+		}
+		Promise.set_value(Completed);
+	}
+};
+
+} // namespace detail
+
+// Tracks a reversal running in the background. Copies refer to the same
+// reversal.
+class AsyncReverse
+{
+public:
+	AsyncReverse(
+		std::shared_ptr<detail::AsyncReverseState> State,
+		std::shared_future<bool> Result
+	)
+		: State(std::move(State)), Result(std::move(Result))
+	{
+	}
+
+	// Chunks that have not been started yet are skipped. Chunks already being
+	// reversed are finished, so the array is left with some of its mirrored
+	// pairs exchanged and the rest in place.
+	void Cancel()
+	{
+		State->Cancelled = true;
+	}
+
+	// Chunks reversed so far, out of ChunkCount
+	std::size_t Completed() const
+	{
+		return State->Done.load();
+	}
+
+	std::size_t ChunkCount() const
+	{
+		return State->ChunkCount;
+	}
+
+	// Fraction of the reversal done, from 0 to 1
+	double Progress() const
+	{
+		return State->ChunkCount
+			? static_cast<double>(Completed()) / State->ChunkCount : 1.0;
+	}
+
+	// Becomes ready once the reversal is over, holding whether it completed
+	const std::shared_future<bool>& Future() const
+	{
+		return Result;
+	}
+
+	bool Ready() const
+	{
+		return Result.wait_for(std::chrono::seconds(0))
+			== std::future_status::ready;
+	}
+
+	// Blocks until the reversal is over and returns whether it completed
+	bool Wait() const
+	{
+		return Result.get();
+	}
+
+private:
+	std::shared_ptr<detail::AsyncReverseState> State;
+	std::shared_future<bool> Result;
+};
+
+// Pool that the reversals without a pool of their own run on
+inline ThreadPool& AsyncPool()
+{
+	static ThreadPool Pool;
+	return Pool;
+}
+
+} // namespace qreverse
+
+// Reverses the array in the background on the threads of Pool and returns
+// right away. The lower half of the array is split into chunks like
+// qReverseParallel, and each chunk is exchanged with its mirrored chunk using
+// the same kernels as qReverse. Callback, if any, is called from the worker
+// that finishes last. The array must stay alive until the reversal is over.
+template< std::size_t ElementSize >
+inline qreverse::AsyncReverse qReverseAsync(
+	void* Array, std::size_t Count, qreverse::ThreadPool& Pool,
+	qreverse::ReverseCallback Callback = nullptr
+)
+{
+	using State = qreverse::detail::AsyncReverseState;
+	const std::shared_ptr<State> Shared = std::make_shared<State>();
+	const std::size_t Pairs = Count / 2;
+	const std::size_t Chunk = qreverse::ParallelChunkSize / ElementSize
+		? qreverse::ParallelChunkSize / ElementSize : 1;
+	Shared->ChunkCount = (Pairs + Chunk - 1) / Chunk;
+	Shared->Callback = std::move(Callback);
+	qreverse::AsyncReverse Handle(Shared, Shared->Promise.get_future().share());
+
+	const qreverse::ReverseProc Reverse =
+		qreverse::SelectReverseProc<ElementSize>();
+	const auto Work = [=]()
+	{
+		while( !Shared->Cancelled )
+		{
+			const std::size_t i = Shared->Next.fetch_add(1);
+			if( i >= Shared->ChunkCount )
+			{
+				break;
+			}
+			const std::size_t Begin = i * Chunk;
+			const std::size_t End = Begin + Chunk < Pairs ? Begin + Chunk : Pairs;
+			Reverse(Array, Count, Begin, End);
+			++Shared->Done;
+		}
+		if( --Shared->Active == 0 )
+		{
+			Shared->Finish();
+		}
+	};
+
+	// Without any workers to hand it to, the reversal happens right here
+	const std::size_t Workers = Shared->ChunkCount < Pool.ThreadCount()
+		? Shared->ChunkCount : Pool.ThreadCount();
+	if( !Workers )
+	{
+		Shared->Active = 1;
+		Work();
+		return Handle;
+	}
+	Shared->Active = Workers;
+	for( std::size_t i = 0; i < Workers; ++i )
+	{
+		Pool.Submit(Work);
+	}
+	return Handle;
+}
+
+// Runs on the shared qreverse::AsyncPool
+template< std::size_t ElementSize >
+inline qreverse::AsyncReverse qReverseAsync(
+	void* Array, std::size_t Count, qreverse::ReverseCallback Callback = nullptr
+)
+{
+	return qReverseAsync<ElementSize>(
+		Array, Count, qreverse::AsyncPool(), std::move(Callback)
+	);
+}
@@ -0,0 +1,228 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+#include <qreverse.hpp>
+
+namespace qreverse
+{
+
+// Reverses Count[k] elements of each array Arrays[k] for k < Batch
+using ReverseBatchProc = void(*)(
+	void* const* Arrays, const std::size_t* Counts, std::size_t Batch
+);
+
+namespace detail
+{
+
+// Arrays of a fixed-stride batch passed to the batch kernels at a time
+constexpr std::size_t BatchChunkSize = 256;
+
+#if defined(QREVERSE_X86)
+// Whether an array is in the size class of ReverseWholeAVX512
+template< std::size_t ElementSize >
+inline bool FitsAVX512(std::size_t Count)
+{
+	return RegisterReverse<ElementSize>::AVX512
+		&& Count * ElementSize - 1 < 64;
+}
+#endif
+
+/// Batch kernels
+// Run the leading-tier kernel over every array of the batch from within a
+// function compiled for that same tier, so the kernel is entered through a
+// direct call that can be inlined rather than a dispatch per array. The
+// AVX-512 tiers reverse the arrays that fit within a register in one step.
+
+template< std::size_t ElementSize >
+void BatchKernelSerial(
+	void* const* Arrays, const std::size_t* Counts, std::size_t Batch
+)
+{
+	for( std::size_t k = 0; k < Batch; ++k )
+	{
+		KernelSerial<ElementSize>(Arrays[k], Counts[k], 0, Counts[k] / 2);
+	}
+}
+
+template< std::size_t ElementSize >
+void BatchKernelSwap(
+	void* const* Arrays, const std::size_t* Counts, std::size_t Batch
+)
+{
+	for( std::size_t k = 0; k < Batch; ++k )
+	{
+		KernelSwap<ElementSize>(Arrays[k], Counts[k], 0, Counts[k] / 2);
+	}
+}
+
+#if defined(QREVERSE_X86)
+template< std::size_t ElementSize >
+QREVERSE_TARGET_SSSE3
+void BatchKernelSSSE3(
+	void* const* Arrays, const std::size_t* Counts, std::size_t Batch
+)
+{
+	for( std::size_t k = 0; k < Batch; ++k )
+	{
+		KernelSSSE3<ElementSize>(Arrays[k], Counts[k], 0, Counts[k] / 2);
+	}
+}
+
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX2
+void BatchKernelAVX2(
+	void* const* Arrays, const std::size_t* Counts, std::size_t Batch
+)
+{
+	for( std::size_t k = 0; k < Batch; ++k )
+	{
+		KernelAVX2<ElementSize>(Arrays[k], Counts[k], 0, Counts[k] / 2);
+	}
+}
+
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX512
+void BatchKernelAVX512(
+	void* const* Arrays, const std::size_t* Counts, std::size_t Batch
+)
+{
+	for( std::size_t k = 0; k < Batch; ++k )
+	{
+		if( FitsAVX512<ElementSize>(Counts[k]) )
+		{
+			ReverseWholeAVX512<ElementSize>(Arrays[k], Counts[k]);
+			continue;
+		}
+		KernelAVX512<ElementSize>(Arrays[k], Counts[k], 0, Counts[k] / 2);
+	}
+}
+
+template< std::size_t ElementSize >
+QREVERSE_TARGET_AVX512VBMI
+void BatchKernelAVX512VBMI(
+	void* const* Arrays, const std::size_t* Counts, std::size_t Batch
+)
+{
+	for( std::size_t k = 0; k < Batch; ++k )
+	{
+		if( FitsAVX512<ElementSize>(Counts[k]) )
+		{
+			ReverseWholeAVX512<ElementSize>(Arrays[k], Counts[k]);
+			continue;
+		}
+		KernelAVX512VBMI<ElementSize>(Arrays[k], Counts[k], 0, Counts[k] / 2);
+	}
+}
+#endif
+
+#if defined(QREVERSE_NEON)
+template< std::size_t ElementSize >
+void BatchKernelNEON(
+	void* const* Arrays, const std::size_t* Counts, std::size_t Batch
+)
+{
+	for( std::size_t k = 0; k < Batch; ++k )
+	{
+		KernelNEON<ElementSize>(Arrays[k], Counts[k], 0, Counts[k] / 2);
+	}
+}
+#endif
+
+#if defined(QREVERSE_SVE)
+template< std::size_t ElementSize >
+void BatchKernelSVE(
+	void* const* Arrays, const std::size_t* Counts, std::size_t Batch
+)
+{
+	for( std::size_t k = 0; k < Batch; ++k )
+	{
+		KernelSVE<ElementSize>(Arrays[k], Counts[k], 0, Counts[k] / 2);
+	}
+}
+#endif
+
+} // namespace detail
+
+template< std::size_t ElementSize >
+inline ReverseBatchProc GetReverseBatchProc(Tier Level)
+{
+	static const ReverseBatchProc Procs[static_cast<std::size_t>(Tier::Count)] = {
+		detail::BatchKernelSerial<ElementSize>,
+		detail::BatchKernelSwap<ElementSize>,
+#if defined(QREVERSE_X86)
+		detail::BatchKernelSSSE3<ElementSize>,
+#else
+		nullptr,
+#endif
+#if defined(QREVERSE_NEON)
+		detail::BatchKernelNEON<ElementSize>,
+#else
+		nullptr,
+#endif
+#if defined(QREVERSE_X86)
+		detail::BatchKernelAVX2<ElementSize>,
+		detail::BatchKernelAVX512<ElementSize>,
+		detail::BatchKernelAVX512VBMI<ElementSize>,
+#else
+		nullptr,
+		nullptr,
+		nullptr,
+#endif
+#if defined(QREVERSE_SVE)
+		detail::BatchKernelSVE<ElementSize>,
+#else
+		nullptr,
+#endif
+	};
+	if( Level >= Tier::Count || !TierSupported(Level) )
+	{
+		return nullptr;
+	}
+	return Procs[static_cast<std::size_t>(Level)];
+}
+
+template< std::size_t ElementSize >
+inline ReverseBatchProc SelectReverseBatchProc()
+{
+	static const ReverseBatchProc Proc =
+		GetReverseBatchProc<ElementSize>(HighestTier());
+	return Proc;
+}
+
+} // namespace qreverse
+
+// Reverses each of Batch independent arrays in-place, the k-th of which is
+// Counts[k] elements long
+template< std::size_t ElementSize >
+inline void qReverseBatch(
+	void* const* Arrays, const std::size_t* Counts, std::size_t Batch
+)
+{
+	qreverse::SelectReverseBatchProc<ElementSize>()(Arrays, Counts, Batch);
+}
+
+// Reverses each of Batch arrays of Count elements in-place, with the arrays
+// starting Stride bytes apart from Base
+template< std::size_t ElementSize >
+inline void qReverseBatchStrided(
+	void* Base, std::size_t Count, std::size_t Stride, std::size_t Batch
+)
+{
+	const qreverse::ReverseBatchProc Proc =
+		qreverse::SelectReverseBatchProc<ElementSize>();
+	std::uint8_t* Base8 = reinterpret_cast<std::uint8_t*>(Base);
+	void* Arrays[qreverse::detail::BatchChunkSize];
+	std::size_t Counts[qreverse::detail::BatchChunkSize];
+	for( std::size_t k = 0; k < Batch; k += qreverse::detail::BatchChunkSize )
+	{
+		const std::size_t Chunk = Batch - k < qreverse::detail::BatchChunkSize
+			? Batch - k : qreverse::detail::BatchChunkSize;
+		for( std::size_t j = 0; j < Chunk; ++j )
+		{
+			Arrays[j] = &Base8[(k + j) * Stride];
+			Counts[j] = Count;
+		}
+		Proc(Arrays, Counts, Chunk);
+	}
+}
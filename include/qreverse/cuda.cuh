@@ -0,0 +1,237 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+#include <cuda_runtime.h>
+
+/*
+Reversal of arrays that live in device memory, for pipelines that would
+otherwise copy them to the host and back only to reverse them. Requires
+compiling with nvcc.
+
+Each block exchanges a tile from the lower end of the array with its mirrored
+tile from the upper end. Both tiles are read and written at ascending
+addresses so that every access of a warp coalesces, with the reversal itself
+happening through shared memory in between.
+*/
+
+namespace qreverse
+{
+
+// Threads per block, and so elements per tile, for elements of up to 64 bytes
+constexpr std::size_t DeviceBlockSize = 256;
+
+// Bytes of shared memory that each tile takes up at most. The in-place kernel
+// holds two tiles, which stays within the 48KiB of static shared memory that
+// every device allows a block.
+constexpr std::size_t DeviceTileBytes = 16u * 1024u;
+
+// Blocks to launch at most, any further tiles are strided over
+constexpr std::size_t DeviceMaxBlocks = 65535;
+
+namespace detail
+{
+
+// Element sizes that map onto a native type are moved with a single load and
+// store each. Any other size is moved as a plain run of bytes.
+template< std::size_t ElementSize >
+struct DeviceElement
+{
+	std::uint8_t Bytes[ElementSize];
+};
+
+template<>
+struct DeviceElement<1>
+{
+	std::uint8_t Value;
+};
+
+template<>
+struct DeviceElement<2>
+{
+	std::uint16_t Value;
+};
+
+template<>
+struct DeviceElement<4>
+{
+	std::uint32_t Value;
+};
+
+template<>
+struct DeviceElement<8>
+{
+	std::uint64_t Value;
+};
+
+template<>
+struct DeviceElement<16>
+{
+	uint4 Value;
+};
+
+// Elements per tile, and so threads per block. Larger elements get fewer of
+// them so that a tile stays within DeviceTileBytes.
+template< std::size_t ElementSize >
+struct DeviceTileSize : std::integral_constant<
+	std::size_t,
+	ElementSize * DeviceBlockSize <= DeviceTileBytes
+		? DeviceBlockSize : DeviceTileBytes / ElementSize
+>
+{
+	static_assert(
+		ElementSize <= DeviceTileBytes, "Element does not fit into a tile"
+	);
+};
+
+template< std::size_t ElementSize >
+__global__ void DeviceReverseKernel(void* Array, std::size_t Count)
+{
+	using Element = DeviceElement<ElementSize>;
+	constexpr std::size_t TileSize = DeviceTileSize<ElementSize>::value;
+	__shared__ Element LowerTile[TileSize];
+	__shared__ Element UpperTile[TileSize];
+
+	Element* Elements = reinterpret_cast<Element*>(Array);
+	const std::size_t Half = Count / 2;
+	const std::size_t Tiles = (Half + TileSize - 1) / TileSize;
+	const std::size_t x = threadIdx.x;
+	for( std::size_t Tile = blockIdx.x; Tile < Tiles; Tile += gridDim.x )
+	{
+		// Lower element of this thread, and the lower element that mirrors the
+		// upper element of this thread. Only the lower half is exchanged.
+		const std::size_t Lower = Tile * TileSize + x;
+		const std::size_t Mirror = (Tile + 1) * TileSize - 1 - x;
+		const std::size_t Upper = Count - 1 - Mirror;
+
+		if( Lower < Half )
+		{
+			LowerTile[x] = Elements[Lower];
+		}
+		if( Mirror < Half )
+		{
+			UpperTile[x] = Elements[Upper];
+		}
+		__syncthreads();
+
+		// Place them at their swapped position
+		if( Lower < Half )
+		{
+			Elements[Lower] = UpperTile[TileSize - 1 - x];
+		}
+		if( Mirror < Half )
+		{
+			Elements[Upper] = LowerTile[TileSize - 1 - x];
+		}
+		// The tiles are reused by the next iteration
+		__syncthreads();
+	}
+}
+
+template< std::size_t ElementSize >
+__global__ void DeviceReverseCopyKernel(
+	const void* Src, void* Dst, std::size_t Count
+)
+{
+	using Element = DeviceElement<ElementSize>;
+	constexpr std::size_t TileSize = DeviceTileSize<ElementSize>::value;
+	__shared__ Element Tile[TileSize];
+
+	const Element* SrcElements = reinterpret_cast<const Element*>(Src);
+	Element* DstElements = reinterpret_cast<Element*>(Dst);
+	const std::size_t Tiles = (Count + TileSize - 1) / TileSize;
+	const std::size_t x = threadIdx.x;
+	for( std::size_t Block = blockIdx.x; Block < Tiles; Block += gridDim.x )
+	{
+		// Destination element of this thread, and the destination element that
+		// the source element of this thread is written to
+		const std::size_t Write = Block * TileSize + x;
+		const std::size_t Mirror = (Block + 1) * TileSize - 1 - x;
+
+		if( Mirror < Count )
+		{
+			Tile[x] = SrcElements[Count - 1 - Mirror];
+		}
+		__syncthreads();
+
+		if( Write < Count )
+		{
+			DstElements[Write] = Tile[TileSize - 1 - x];
+		}
+		__syncthreads();
+	}
+}
+
+// Blocks to launch for Count elements of tiles of TileSize elements each
+inline unsigned int DeviceBlocks(std::size_t Count, std::size_t TileSize)
+{
+	const std::size_t Tiles = (Count + TileSize - 1) / TileSize;
+	return static_cast<unsigned int>(
+		Tiles < DeviceMaxBlocks ? Tiles : DeviceMaxBlocks
+	);
+}
+
+} // namespace detail
+
+} // namespace qreverse
+
+// Reverses an array of device memory in-place, queued onto Stream. Returns
+// without waiting for the reversal, so it overlaps with anything else on other
+// streams. Returns the error of the launch, if any.
+template< std::size_t ElementSize >
+inline cudaError_t qReverseDeviceAsync(
+	void* Array, std::size_t Count, cudaStream_t Stream = 0
+)
+{
+	if( Count < 2 )
+	{
+		return cudaSuccess;
+	}
+	constexpr std::size_t TileSize =
+		qreverse::detail::DeviceTileSize<ElementSize>::value;
+	qreverse::detail::DeviceReverseKernel<ElementSize><<<
+		qreverse::detail::DeviceBlocks(Count / 2, TileSize), TileSize, 0, Stream
+	>>>(Array, Count);
+	return cudaGetLastError();
+}
+
+// Writes the Count elements of device memory Src into Dst in reverse order,
+// queued onto Stream. Src and Dst must not overlap.
+template< std::size_t ElementSize >
+inline cudaError_t qReverseCopyDeviceAsync(
+	const void* Src, void* Dst, std::size_t Count, cudaStream_t Stream = 0
+)
+{
+	if( Count == 0 )
+	{
+		return cudaSuccess;
+	}
+	constexpr std::size_t TileSize =
+		qreverse::detail::DeviceTileSize<ElementSize>::value;
+	qreverse::detail::DeviceReverseCopyKernel<ElementSize><<<
+		qreverse::detail::DeviceBlocks(Count, TileSize), TileSize, 0, Stream
+	>>>(Src, Dst, Count);
+	return cudaGetLastError();
+}
+
+// The same as qReverse for an array of device memory. Waits for the reversal
+// to finish before returning the first error of either.
+template< std::size_t ElementSize >
+inline cudaError_t qReverseDevice(void* Array, std::size_t Count)
+{
+	const cudaError_t Error = qReverseDeviceAsync<ElementSize>(Array, Count);
+	return Error != cudaSuccess ? Error : cudaStreamSynchronize(0);
+}
+
+// The same as qReverseCopy for arrays of device memory
+template< std::size_t ElementSize >
+inline cudaError_t qReverseCopyDevice(
+	const void* Src, void* Dst, std::size_t Count
+)
+{
+	const cudaError_t Error = qReverseCopyDeviceAsync<ElementSize>(
+		Src, Dst, Count
+	);
+	return Error != cudaSuccess ? Error : cudaStreamSynchronize(0);
+}
@@ -0,0 +1,187 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cerrno>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <qreverse.hpp>
+
+namespace qreverse
+{
+
+// Bytes read from each end of a file at a time. The two windows together bound
+// the memory that a file reversal uses regardless of the size of the file.
+constexpr std::size_t FileWindowSize = 1024u * 1024u;
+
+namespace detail
+{
+
+inline bool ReadAll(int File, void* Data, std::size_t Size, off_t Offset)
+{
+	std::uint8_t* Data8 = reinterpret_cast<std::uint8_t*>(Data);
+	while( Size )
+	{
+		const ssize_t Read = pread(File, Data8, Size, Offset);
+		if( Read < 0 && errno == EINTR )
+		{
+			continue;
+		}
+		if( Read <= 0 )
+		{
+			if( Read == 0 )
+			{
+				errno = EIO;
+			}
+			return false;
+		}
+		Data8 += Read;
+		Size -= static_cast<std::size_t>(Read);
+		Offset += Read;
+	}
+	return true;
+}
+
+inline bool WriteAll(int File, const void* Data, std::size_t Size, off_t Offset)
+{
+	const std::uint8_t* Data8 = reinterpret_cast<const std::uint8_t*>(Data);
+	while( Size )
+	{
+		const ssize_t Written = pwrite(File, Data8, Size, Offset);
+		if( Written < 0 && errno == EINTR )
+		{
+			continue;
+		}
+		if( Written < 0 )
+		{
+			return false;
+		}
+		Data8 += Written;
+		Size -= static_cast<std::size_t>(Written);
+		Offset += Written;
+	}
+	return true;
+}
+
+// Starts reading a window in ahead of time. Read-ahead only follows ascending
+// reads on its own, which leaves the tail of the file to be asked for.
+inline void AdviseWillNeed(int File, off_t Offset, std::size_t Size)
+{
+#if defined(POSIX_FADV_WILLNEED)
+	posix_fadvise(File, Offset, static_cast<off_t>(Size), POSIX_FADV_WILLNEED);
+#else
+	(void)File;
+	(void)Offset;
+	(void)Size;
+#endif
+}
+
+} // namespace detail
+
+} // namespace qreverse
+
+// Reverses the ElementSize-byte elements of an open file in-place, streaming
+// mirrored windows of up to WindowSize bytes in from both ends. Returns false
+// with errno set if the file could not be read or written, or if its size is
+// not a whole number of elements.
+template< std::size_t ElementSize >
+inline bool qReverseFile(
+	int File, std::size_t WindowSize = qreverse::FileWindowSize
+)
+{
+	struct stat Info;
+	if( fstat(File, &Info) != 0 )
+	{
+		return false;
+	}
+	const std::size_t Size = static_cast<std::size_t>(Info.st_size);
+	if( Size % ElementSize )
+	{
+		errno = EINVAL;
+		return false;
+	}
+
+	// Windows hold a whole number of elements
+	const std::size_t Window = WindowSize / ElementSize
+		? WindowSize / ElementSize * ElementSize : ElementSize;
+	std::vector<std::uint8_t> Buffer(Size < 2 * Window ? Size : 2 * Window);
+	std::uint8_t* Head = Buffer.data();
+	std::uint8_t* Tail = Buffer.data() + Window;
+
+	// Bytes reversed from each end so far
+	std::size_t i = 0;
+	for( ; Size - 2 * i >= 2 * Window; i += Window )
+	{
+		const off_t HeadOffset = static_cast<off_t>(i);
+		const off_t TailOffset = static_cast<off_t>(Size - i - Window);
+
+		// Have the next pair of windows read in while this one is reversed
+		if( Size - 2 * i >= 4 * Window )
+		{
+			qreverse::detail::AdviseWillNeed(File, HeadOffset + Window, Window);
+			qreverse::detail::AdviseWillNeed(File, TailOffset - Window, Window);
+		}
+
+		if(
+			!qreverse::detail::ReadAll(File, Head, Window, HeadOffset)
+			|| !qreverse::detail::ReadAll(File, Tail, Window, TailOffset)
+		)
+		{
+			return false;
+		}
+
+		qReverse<ElementSize>(Head, Window / ElementSize);
+		qReverse<ElementSize>(Tail, Window / ElementSize);
+
+		// Place them at their swapped position
+		if(
+			!qreverse::detail::WriteAll(File, Tail, Window, HeadOffset)
+			|| !qreverse::detail::WriteAll(File, Head, Window, TailOffset)
+		)
+		{
+			return false;
+		}
+	}
+
+	// Less than two windows are left in the middle, which fit the buffer
+	const std::size_t Middle = Size - 2 * i;
+	if( Middle )
+	{
+		const off_t MiddleOffset = static_cast<off_t>(i);
+		if( !qreverse::detail::ReadAll(File, Buffer.data(), Middle, MiddleOffset) )
+		{
+			return false;
+		}
+		qReverse<ElementSize>(Buffer.data(), Middle / ElementSize);
+		if( !qreverse::detail::WriteAll(File, Buffer.data(), Middle, MiddleOffset) )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Opens and reverses the file at Path in-place
+template< std::size_t ElementSize >
+inline bool qReverseFile(
+	const char* Path, std::size_t WindowSize = qreverse::FileWindowSize
+)
+{
+	const int File = open(Path, O_RDWR);
+	if( File < 0 )
+	{
+		return false;
+	}
+	const bool Reversed = qReverseFile<ElementSize>(File, WindowSize);
+	// Keep the errno of whatever failed first
+	const int Error = errno;
+	if( close(File) != 0 && Reversed )
+	{
+		return false;
+	}
+	errno = Error;
+	return Reversed;
+}
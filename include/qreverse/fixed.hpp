@@ -0,0 +1,429 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+#include <qreverse.hpp>
+
+namespace qreverse
+{
+
+using ReverseFixedProc = void(*)(void* Array);
+
+template< std::size_t ElementSize, std::size_t Count >
+inline ReverseFixedProc SelectReverseFixedProc();
+
+namespace detail
+{
+
+/// Fixed-count steps
+// With the element count known at compile time each step is a template over
+// the index it starts at. A step exchanges one pair of registers and then
+// instantiates the step after it, and once its tier no longer fits it hands
+// the untouched middle of the array down to the next narrower tier. Nothing
+// is left to be decided at run-time outside of the choice of tier.
+// A middle of exactly one register is reversed in-place with a single load and
+// store, so that a 32 byte array is one AVX-2 shuffle and lane swap.
+
+#if defined(QREVERSE_X86)
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+inline std::size_t FixedSSSE3(void* Array);
+
+// SSSE3
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+QREVERSE_TARGET_SSSE3
+inline std::size_t FixedSSSE3Step(void* Array, std::true_type)
+{
+	using Register = RegisterReverse<ElementSize>;
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	const std::size_t Width = 16 / ElementSize;
+	__m128i* LowerPtr = reinterpret_cast<__m128i*>(&Array8[i * ElementSize]);
+	__m128i* UpperPtr = reinterpret_cast<__m128i*>(
+		&Array8[(Count - i - Width) * ElementSize]
+	);
+
+	const __m128i Lower = Register::Reverse128(_mm_loadu_si128(LowerPtr));
+	const __m128i Upper = Register::Reverse128(_mm_loadu_si128(UpperPtr));
+
+	_mm_storeu_si128(LowerPtr, Upper);
+	_mm_storeu_si128(UpperPtr, Lower);
+	return FixedSSSE3<ElementSize, Count, i + Width>(Array);
+}
+
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+QREVERSE_TARGET_SSSE3
+inline std::size_t FixedSSSE3Step(void* Array, std::false_type)
+{
+	using Register = RegisterReverse<ElementSize>;
+	if( Register::SSSE3 && (Count - 2 * i) * ElementSize == 16 )
+	{
+		std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+		__m128i* Middle = reinterpret_cast<__m128i*>(&Array8[i * ElementSize]);
+		_mm_storeu_si128(Middle, Register::Reverse128(_mm_loadu_si128(Middle)));
+		return Count / 2;
+	}
+	return i;
+}
+
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+inline std::size_t FixedSSSE3(void* Array)
+{
+	using Register = RegisterReverse<ElementSize>;
+	return FixedSSSE3Step<ElementSize, Count, i>(
+		Array,
+		std::integral_constant<
+			bool,
+			Register::SSSE3
+				&& i + (Register::SSSE3 ? 16 / ElementSize : 1) <= Count / 2
+		>()
+	);
+}
+
+// AVX-2
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+inline std::size_t FixedAVX2(void* Array);
+
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+QREVERSE_TARGET_AVX2
+inline std::size_t FixedAVX2Step(void* Array, std::true_type)
+{
+	using Register = RegisterReverse<ElementSize>;
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	const std::size_t Width = 32 / ElementSize;
+	__m256i* LowerPtr = reinterpret_cast<__m256i*>(&Array8[i * ElementSize]);
+	__m256i* UpperPtr = reinterpret_cast<__m256i*>(
+		&Array8[(Count - i - Width) * ElementSize]
+	);
+
+	const __m256i Lower = Register::Reverse256(_mm256_loadu_si256(LowerPtr));
+	const __m256i Upper = Register::Reverse256(_mm256_loadu_si256(UpperPtr));
+
+	_mm256_storeu_si256(LowerPtr, Upper);
+	_mm256_storeu_si256(UpperPtr, Lower);
+	return FixedAVX2<ElementSize, Count, i + Width>(Array);
+}
+
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+QREVERSE_TARGET_AVX2
+inline std::size_t FixedAVX2Step(void* Array, std::false_type)
+{
+	using Register = RegisterReverse<ElementSize>;
+	if( Register::AVX2 && (Count - 2 * i) * ElementSize == 32 )
+	{
+		std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+		__m256i* Middle = reinterpret_cast<__m256i*>(&Array8[i * ElementSize]);
+		_mm256_storeu_si256(
+			Middle, Register::Reverse256(_mm256_loadu_si256(Middle))
+		);
+		return Count / 2;
+	}
+	return FixedSSSE3<ElementSize, Count, i>(Array);
+}
+
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+inline std::size_t FixedAVX2(void* Array)
+{
+	using Register = RegisterReverse<ElementSize>;
+	return FixedAVX2Step<ElementSize, Count, i>(
+		Array,
+		std::integral_constant<
+			bool,
+			Register::AVX2
+				&& i + (Register::AVX2 ? 32 / ElementSize : 1) <= Count / 2
+		>()
+	);
+}
+
+// AVX-512BW/F
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+inline std::size_t FixedAVX512(void* Array);
+
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+QREVERSE_TARGET_AVX512
+inline std::size_t FixedAVX512Step(void* Array, std::true_type)
+{
+	using Register = RegisterReverse<ElementSize>;
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	const std::size_t Width = 64 / ElementSize;
+	std::uint8_t* LowerPtr = &Array8[i * ElementSize];
+	std::uint8_t* UpperPtr = &Array8[(Count - i - Width) * ElementSize];
+
+	const __m512i Lower = Register::Reverse512(_mm512_loadu_si512(LowerPtr));
+	const __m512i Upper = Register::Reverse512(_mm512_loadu_si512(UpperPtr));
+
+	_mm512_storeu_si512(LowerPtr, Upper);
+	_mm512_storeu_si512(UpperPtr, Lower);
+	return FixedAVX512<ElementSize, Count, i + Width>(Array);
+}
+
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+QREVERSE_TARGET_AVX512
+inline std::size_t FixedAVX512Step(void* Array, std::false_type)
+{
+	using Register = RegisterReverse<ElementSize>;
+	const std::size_t Bytes = (Count - 2 * i) * ElementSize;
+	std::uint8_t* Middle =
+		reinterpret_cast<std::uint8_t*>(Array) + i * ElementSize;
+	if( Register::AVX512 && Bytes == 64 )
+	{
+		_mm512_storeu_si512(
+			Middle, Register::Reverse512(_mm512_loadu_si512(Middle))
+		);
+		return Count / 2;
+	}
+	if( Register::AVX512 && i == 0 && Bytes > 32 && Bytes < 64 )
+	{
+		ReverseWholeAVX512<ElementSize>(Middle, Bytes / ElementSize);
+		return Count / 2;
+	}
+	return FixedAVX2<ElementSize, Count, i>(Array);
+}
+
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+inline std::size_t FixedAVX512(void* Array)
+{
+	using Register = RegisterReverse<ElementSize>;
+	return FixedAVX512Step<ElementSize, Count, i>(
+		Array,
+		std::integral_constant<
+			bool,
+			Register::AVX512
+				&& i + (Register::AVX512 ? 64 / ElementSize : 1) <= Count / 2
+		>()
+	);
+}
+#endif
+
+#if defined(QREVERSE_NEON)
+// NEON
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+inline std::size_t FixedNEON(void* Array);
+
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+inline std::size_t FixedNEONStep(void* Array, std::true_type)
+{
+	using Register = RegisterReverse<ElementSize>;
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	const std::size_t Width = 16 / ElementSize;
+	std::uint8_t* LowerPtr = &Array8[i * ElementSize];
+	std::uint8_t* UpperPtr = &Array8[(Count - i - Width) * ElementSize];
+
+	const uint8x16_t Lower = Register::ReverseNEON(vld1q_u8(LowerPtr));
+	const uint8x16_t Upper = Register::ReverseNEON(vld1q_u8(UpperPtr));
+
+	vst1q_u8(LowerPtr, Upper);
+	vst1q_u8(UpperPtr, Lower);
+	return FixedNEON<ElementSize, Count, i + Width>(Array);
+}
+
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+inline std::size_t FixedNEONStep(void* Array, std::false_type)
+{
+	using Register = RegisterReverse<ElementSize>;
+	if( Register::NEON && (Count - 2 * i) * ElementSize == 16 )
+	{
+		std::uint8_t* Middle =
+			reinterpret_cast<std::uint8_t*>(Array) + i * ElementSize;
+		vst1q_u8(Middle, Register::ReverseNEON(vld1q_u8(Middle)));
+		return Count / 2;
+	}
+	return i;
+}
+
+template< std::size_t ElementSize, std::size_t Count, std::size_t i >
+inline std::size_t FixedNEON(void* Array)
+{
+	using Register = RegisterReverse<ElementSize>;
+	return FixedNEONStep<ElementSize, Count, i>(
+		Array,
+		std::integral_constant<
+			bool,
+			Register::NEON
+				&& i + (Register::NEON ? 16 / ElementSize : 1) <= Count / 2
+		>()
+	);
+}
+#endif
+
+/// Fixed-count kernels
+// Whatever the fixed-count steps leave over goes through the regular steps.
+// Their bounds are constant here too so their loops fold away.
+
+// Element sizes that the fixed-count steps have a register permutation for,
+// such as 32 byte elements that only fit the AVX-2 and AVX-512 registers. The
+// rest are left to the regular kernels, as there is nothing to unroll.
+template< std::size_t ElementSize >
+struct HasFixedSteps : std::integral_constant<
+	bool,
+	RegisterReverse<ElementSize>::SSSE3 || RegisterReverse<ElementSize>::NEON
+		|| RegisterReverse<ElementSize>::AVX2
+		|| RegisterReverse<ElementSize>::AVX512
+>
+{
+};
+
+template< std::size_t ElementSize, std::size_t Count >
+void FixedKernelSerial(void* Array)
+{
+	ReverseSerial<ElementSize>(Array, Count, 0, Count / 2);
+}
+
+template< std::size_t ElementSize, std::size_t Count >
+void FixedKernelSwap(void* Array)
+{
+	std::size_t i = 0;
+	i = ReverseSwap<ElementSize>(Array, Count, i, Count / 2);
+	ReverseSerial<ElementSize>(Array, Count, i, Count / 2);
+}
+
+#if defined(QREVERSE_X86)
+template< std::size_t ElementSize, std::size_t Count >
+QREVERSE_TARGET_SSSE3
+void FixedKernelSSSE3(void* Array)
+{
+	std::size_t i = 0;
+	i = FixedSSSE3<ElementSize, Count, 0>(Array);
+	i = ReverseSSSE3<ElementSize>(Array, Count, i, Count / 2);
+	i = ReverseWideSSSE3<ElementSize>(Array, Count, i, Count / 2);
+	i = ReverseSwap<ElementSize>(Array, Count, i, Count / 2);
+	ReverseSerial<ElementSize>(Array, Count, i, Count / 2);
+}
+
+template< std::size_t ElementSize, std::size_t Count >
+QREVERSE_TARGET_AVX2
+void FixedKernelAVX2(void* Array)
+{
+	std::size_t i = 0;
+	i = FixedAVX2<ElementSize, Count, 0>(Array);
+	i = ReverseSSSE3<ElementSize>(Array, Count, i, Count / 2);
+	i = ReverseSwap<ElementSize>(Array, Count, i, Count / 2);
+	ReverseSerial<ElementSize>(Array, Count, i, Count / 2);
+}
+
+template< std::size_t ElementSize, std::size_t Count >
+QREVERSE_TARGET_AVX512
+void FixedKernelAVX512(void* Array)
+{
+	std::size_t i = 0;
+	i = FixedAVX512<ElementSize, Count, 0>(Array);
+	i = ReverseSSSE3<ElementSize>(Array, Count, i, Count / 2);
+	i = ReverseSwap<ElementSize>(Array, Count, i, Count / 2);
+	ReverseSerial<ElementSize>(Array, Count, i, Count / 2);
+}
+
+template< std::size_t ElementSize, std::size_t Count >
+QREVERSE_TARGET_AVX512VBMI
+void FixedKernelAVX512VBMI(void* Array)
+{
+	// VBMI only adds permutations for the element sizes that are left to the
+	// regular kernels, so the AVX-512 steps cover the rest just the same
+	std::size_t i = 0;
+	i = FixedAVX512<ElementSize, Count, 0>(Array);
+	i = ReverseSSSE3<ElementSize>(Array, Count, i, Count / 2);
+	i = ReverseSwap<ElementSize>(Array, Count, i, Count / 2);
+	ReverseSerial<ElementSize>(Array, Count, i, Count / 2);
+}
+#endif
+
+#if defined(QREVERSE_NEON)
+template< std::size_t ElementSize, std::size_t Count >
+void FixedKernelNEON(void* Array)
+{
+	std::size_t i = 0;
+	i = FixedNEON<ElementSize, Count, 0>(Array);
+	i = ReverseNEON<ElementSize>(Array, Count, i, Count / 2);
+	i = ReverseWideNEON<ElementSize>(Array, Count, i, Count / 2);
+	i = ReverseSwap<ElementSize>(Array, Count, i, Count / 2);
+	ReverseSerial<ElementSize>(Array, Count, i, Count / 2);
+}
+#endif
+
+#if defined(QREVERSE_SVE)
+template< std::size_t ElementSize, std::size_t Count >
+void FixedKernelSVE(void* Array)
+{
+	// The vector length is only known at run-time, though its predicated steps
+	// already leave no tail behind
+	std::size_t i = 0;
+	i = ReverseSVE<ElementSize>(Array, Count, i, Count / 2);
+	i = ReverseNEON<ElementSize>(Array, Count, i, Count / 2);
+	i = ReverseSwap<ElementSize>(Array, Count, i, Count / 2);
+	ReverseSerial<ElementSize>(Array, Count, i, Count / 2);
+}
+#endif
+
+template< std::size_t ElementSize, std::size_t Count >
+inline void ReverseFixed(void* Array, std::true_type)
+{
+	SelectReverseFixedProc<ElementSize, Count>()(Array);
+}
+
+template< std::size_t ElementSize, std::size_t Count >
+inline void ReverseFixed(void* Array, std::false_type)
+{
+	qReverse<ElementSize>(Array, Count);
+}
+
+} // namespace detail
+
+template< std::size_t ElementSize, std::size_t Count >
+inline ReverseFixedProc GetReverseFixedProc(Tier Level)
+{
+	static const ReverseFixedProc Procs[static_cast<std::size_t>(Tier::Count)] = {
+		detail::FixedKernelSerial<ElementSize, Count>,
+		detail::FixedKernelSwap<ElementSize, Count>,
+#if defined(QREVERSE_X86)
+		detail::FixedKernelSSSE3<ElementSize, Count>,
+#else
+		nullptr,
+#endif
+#if defined(QREVERSE_NEON)
+		detail::FixedKernelNEON<ElementSize, Count>,
+#else
+		nullptr,
+#endif
+#if defined(QREVERSE_X86)
+		detail::FixedKernelAVX2<ElementSize, Count>,
+		detail::FixedKernelAVX512<ElementSize, Count>,
+		detail::FixedKernelAVX512VBMI<ElementSize, Count>,
+#else
+		nullptr,
+		nullptr,
+		nullptr,
+#endif
+#if defined(QREVERSE_SVE)
+		detail::FixedKernelSVE<ElementSize, Count>,
+#else
+		nullptr,
+#endif
+	};
+	if( Level >= Tier::Count || !TierSupported(Level) )
+	{
+		return nullptr;
+	}
+	return Procs[static_cast<std::size_t>(Level)];
+}
+
+template< std::size_t ElementSize, std::size_t Count >
+inline ReverseFixedProc SelectReverseFixedProc()
+{
+	static const ReverseFixedProc Proc =
+		GetReverseFixedProc<ElementSize, Count>(HighestTier());
+	return Proc;
+}
+
+} // namespace qreverse
+
+// Reverses an array of a compile-time number of elements in-place. Meant for
+// small arrays, as every register of the reversal is its own instantiation.
+template< std::size_t ElementSize, std::size_t Count >
+inline void qReverseFixed(void* Array)
+{
+	static_assert(
+		Count * ElementSize <= 4096,
+		"qReverseFixed is meant for arrays of up to 4KiB, use qReverse instead"
+	);
+	qreverse::detail::ReverseFixed<ElementSize, Count>(
+		Array, qreverse::detail::HasFixedSteps<ElementSize>()
+	);
+}
@@ -0,0 +1,281 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <qreverse.hpp>
+
+// Older headers know of hugetlb mappings but not of choosing their page size
+#if defined(MAP_HUGETLB) && !defined(MAP_HUGE_SHIFT)
+#define MAP_HUGE_SHIFT 26
+#endif
+#if defined(MAP_HUGETLB) && !defined(MAP_HUGE_2MB)
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#if defined(MAP_HUGETLB) && !defined(MAP_HUGE_1GB)
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+
+namespace qreverse
+{
+
+// Sizes of the huge pages of x86-64, which are also those of arm64 with 4KiB
+// base pages
+constexpr std::size_t HugePageSize = 2u * 1024u * 1024u;
+constexpr std::size_t GiantPageSize = 1024u * 1024u * 1024u;
+
+// What the pages of a buffer are made of, from the smallest pages up
+enum class PageBacking
+{
+	// Base pages, with transparent huge pages kept away from them
+	Small,
+	// Base pages that the kernel is advised to back with transparent huge
+	// pages as they are touched
+	Transparent,
+	// Reserved pages out of the hugetlb pool of the designated size
+	Huge2M,
+	Huge1G,
+};
+
+namespace detail
+{
+
+inline std::size_t RoundUp(std::size_t Size, std::size_t Multiple)
+{
+	return (Size + Multiple - 1) / Multiple * Multiple;
+}
+
+} // namespace detail
+
+// An anonymous mapping backed by the largest pages that the kernel hands out,
+// so that a reversal's ascending and descending streams each stay within a
+// handful of TLB entries rather than needing a new one every 4KiB. The memory
+// starts out zeroed and is only placed once it is touched.
+class HugeBuffer
+{
+public:
+	HugeBuffer() = default;
+
+	// Maps at least Size bytes, trying each backing from Largest down until
+	// one succeeds. Page sizes larger than Size are skipped so that a small
+	// buffer does not take up a whole huge page. Reserved pages only come out
+	// of a pool that was set aside ahead of time, such as through
+	// /proc/sys/vm/nr_hugepages, and without one the buffer falls back to
+	// transparent huge pages. Data() is null if no mapping could be made.
+	explicit HugeBuffer(
+		std::size_t Size, PageBacking Largest = PageBacking::Huge1G
+	)
+	{
+		for(
+			int Level = static_cast<int>(Largest); Level >= 0 && !Base; --Level
+		)
+		{
+			Map(Size, static_cast<PageBacking>(Level));
+		}
+	}
+
+	~HugeBuffer()
+	{
+		Unmap();
+	}
+
+	HugeBuffer(const HugeBuffer&) = delete;
+	HugeBuffer& operator=(const HugeBuffer&) = delete;
+
+	HugeBuffer(HugeBuffer&& Other) noexcept
+		: Base(Other.Base), Length(Other.Length), Mapped(Other.Mapped),
+		Pages(Other.Pages)
+	{
+		Other.Base = nullptr;
+		Other.Length = Other.Mapped = 0;
+	}
+
+	HugeBuffer& operator=(HugeBuffer&& Other) noexcept
+	{
+		if( this != &Other )
+		{
+			Unmap();
+			Base = Other.Base;
+			Length = Other.Length;
+			Mapped = Other.Mapped;
+			Pages = Other.Pages;
+			Other.Base = nullptr;
+			Other.Length = Other.Mapped = 0;
+		}
+		return *this;
+	}
+
+	void* Data() const
+	{
+		return Base;
+	}
+
+	std::size_t Size() const
+	{
+		return Length;
+	}
+
+	// The backing that the mapping was made with. Transparent huge pages are
+	// only advised, so the kernel may still leave some of them as base pages
+	// when it has no free huge page at hand.
+	PageBacking Backing() const
+	{
+		return Pages;
+	}
+
+private:
+	void Map(std::size_t Size, PageBacking Backing)
+	{
+		void* Region = MAP_FAILED;
+		std::size_t RegionSize = 0;
+		switch( Backing )
+		{
+		case PageBacking::Huge1G:
+		case PageBacking::Huge2M:
+		{
+#if defined(MAP_HUGETLB)
+			const bool Giant = Backing == PageBacking::Huge1G;
+			const std::size_t PageSize = Giant ? GiantPageSize : HugePageSize;
+			if( Size < PageSize )
+			{
+				return;
+			}
+			RegionSize = detail::RoundUp(Size, PageSize);
+			Region = mmap(
+				nullptr, RegionSize, PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB
+					| (Giant ? MAP_HUGE_1GB : MAP_HUGE_2MB),
+				-1, 0
+			);
+#endif
+			break;
+		}
+		case PageBacking::Transparent:
+		{
+#if defined(MADV_HUGEPAGE)
+			if( Size < HugePageSize )
+			{
+				return;
+			}
+			// Transparent huge pages only fit where the mapping covers a whole
+			// aligned huge page, so map a huge page more than needed and trim
+			// the mapping down to an aligned range
+			RegionSize = detail::RoundUp(Size, HugePageSize);
+			std::uint8_t* Reserve = reinterpret_cast<std::uint8_t*>(mmap(
+				nullptr, RegionSize + HugePageSize, PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+			));
+			if( Reserve == MAP_FAILED )
+			{
+				return;
+			}
+			const std::size_t Head = (
+				HugePageSize
+				- reinterpret_cast<std::uintptr_t>(Reserve) % HugePageSize
+			) % HugePageSize;
+			if( Head )
+			{
+				munmap(Reserve, Head);
+			}
+			munmap(Reserve + Head + RegionSize, HugePageSize - Head);
+			Region = Reserve + Head;
+			if( madvise(Region, RegionSize, MADV_HUGEPAGE) )
+			{
+				// Kernels without transparent huge pages
+				munmap(Region, RegionSize);
+				Region = MAP_FAILED;
+			}
+#endif
+			break;
+		}
+		case PageBacking::Small:
+		{
+			RegionSize = detail::RoundUp(
+				Size ? Size : 1, static_cast<std::size_t>(sysconf(_SC_PAGESIZE))
+			);
+			Region = mmap(
+				nullptr, RegionSize, PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+			);
+#if defined(MADV_NOHUGEPAGE)
+			// Keeps "always" transparent huge pages from backing it anyway
+			if( Region != MAP_FAILED )
+			{
+				madvise(Region, RegionSize, MADV_NOHUGEPAGE);
+			}
+#endif
+			break;
+		}
+		}
+		if( Region == MAP_FAILED )
+		{
+			return;
+		}
+		Base = Region;
+		Length = Size;
+		Mapped = RegionSize;
+		Pages = Backing;
+	}
+
+	void Unmap()
+	{
+		if( Base )
+		{
+			munmap(Base, Mapped);
+			Base = nullptr;
+		}
+	}
+
+	void* Base = nullptr;
+	std::size_t Length = 0;
+	std::size_t Mapped = 0;
+	PageBacking Pages = PageBacking::Small;
+};
+
+// Advises the kernel to back the whole huge pages within an existing buffer
+// with transparent huge pages. Pages touched before the advice are only merged
+// later on by khugepaged, so this is best done before the buffer is first
+// written. Returns false if no part of the buffer could be advised.
+inline bool AdviseHugePages(void* Array, std::size_t Size)
+{
+#if defined(MADV_HUGEPAGE)
+	const std::uintptr_t Begin = detail::RoundUp(
+		reinterpret_cast<std::uintptr_t>(Array), HugePageSize
+	);
+	const std::uintptr_t End = (
+		reinterpret_cast<std::uintptr_t>(Array) + Size
+	) / HugePageSize * HugePageSize;
+	return Begin < End && !madvise(
+		reinterpret_cast<void*>(Begin), End - Begin, MADV_HUGEPAGE
+	);
+#else
+	(void)Array;
+	(void)Size;
+	return false;
+#endif
+}
+
+} // namespace qreverse
+
+// Reverse-copies the array into a new buffer backed by huge pages. The
+// reverse-copy kernels read Src front to back and so write the buffer back to
+// front, with non-temporal stores once the copy reaches StreamThreshold(). The
+// copy is still the first to touch each page of the fresh mapping, streamed
+// stores fault pages in all the same, so every page is placed on the node of
+// the calling thread whichever end it starts from. Data() of the result is
+// null if no memory could be mapped at all.
+template< std::size_t ElementSize >
+inline qreverse::HugeBuffer qReverseCopyHuge(
+	const void* Src, std::size_t Count,
+	qreverse::PageBacking Largest = qreverse::PageBacking::Huge1G
+)
+{
+	qreverse::HugeBuffer Buffer(Count * ElementSize, Largest);
+	if( Buffer.Data() && Count )
+	{
+		qReverseCopy<ElementSize>(Src, Buffer.Data(), Count);
+	}
+	return Buffer;
+}
@@ -0,0 +1,371 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <qreverse.hpp>
+#include <qreverse/parallel.hpp>
+
+namespace qreverse
+{
+
+// A memory node along with the processors attached to it
+struct NumaNode
+{
+	int Id;
+	std::vector<int> Cpus;
+};
+
+namespace detail
+{
+
+// Parses a sysfs processor list such as "0-13,28-41"
+inline std::vector<int> ParseCpuList(const char* List)
+{
+	std::vector<int> Cpus;
+	while( *List && *List != '\n' )
+	{
+		char* Next;
+		const long First = std::strtol(List, &Next, 10);
+		if( Next == List )
+		{
+			break;
+		}
+		long Last = First;
+		if( *Next == '-' )
+		{
+			List = Next + 1;
+			Last = std::strtol(List, &Next, 10);
+		}
+		for( long Cpu = First; Cpu <= Last; ++Cpu )
+		{
+			Cpus.push_back(static_cast<int>(Cpu));
+		}
+		List = *Next == ',' ? Next + 1 : Next;
+	}
+	return Cpus;
+}
+
+// The nodes that have processors of their own. Machines without NUMA support
+// come out as a single node of every processor.
+inline std::vector<NumaNode> ProbeNumaNodes()
+{
+	std::vector<NumaNode> Nodes;
+	if( DIR* Directory = opendir("/sys/devices/system/node") )
+	{
+		while( const dirent* Entry = readdir(Directory) )
+		{
+			int Id;
+			if( std::sscanf(Entry->d_name, "node%d", &Id) != 1 )
+			{
+				continue;
+			}
+			const std::string Path = std::string("/sys/devices/system/node/")
+				+ Entry->d_name + "/cpulist";
+			std::FILE* File = std::fopen(Path.c_str(), "r");
+			if( !File )
+			{
+				continue;
+			}
+			char List[4096] = {};
+			if( std::fgets(List, sizeof(List), File) )
+			{
+				NumaNode Node{Id, ParseCpuList(List)};
+				if( !Node.Cpus.empty() )
+				{
+					Nodes.push_back(std::move(Node));
+				}
+			}
+			std::fclose(File);
+		}
+		closedir(Directory);
+	}
+	std::sort(
+		Nodes.begin(), Nodes.end(),
+		[](const NumaNode& A, const NumaNode& B){ return A.Id < B.Id; }
+	);
+	if( Nodes.empty() )
+	{
+		NumaNode Node{0, {}};
+		Nodes.push_back(Node);
+	}
+	return Nodes;
+}
+
+// Restricts the calling thread to the processors of a node
+inline void PinToCpus(const std::vector<int>& Cpus)
+{
+	if( Cpus.empty() )
+	{
+		return;
+	}
+	cpu_set_t Set;
+	CPU_ZERO(&Set);
+	for( const int Cpu : Cpus )
+	{
+		CPU_SET(Cpu, &Set);
+	}
+	sched_setaffinity(0, sizeof(Set), &Set);
+}
+
+// Looks up the node holding the page of each address through move_pages
+// without moving any of them. Pages that have not been touched yet, or that
+// could not be queried at all, come out as negative.
+inline std::vector<int> PageNodes(std::vector<void*>& Pages)
+{
+	std::vector<int> Nodes(Pages.size(), -1);
+#if defined(SYS_move_pages)
+	if(
+		!Pages.empty() && syscall(
+			SYS_move_pages, 0, Pages.size(), Pages.data(), nullptr,
+			Nodes.data(), 0
+		) < 0
+	)
+	{
+		std::fill(Nodes.begin(), Nodes.end(), -1);
+	}
+#endif
+	return Nodes;
+}
+
+} // namespace detail
+
+// A thread pool for each node that has processors, with every worker pinned
+// to the processors of its node
+class NumaPool
+{
+public:
+	NumaPool()
+		: Nodes(detail::ProbeNumaNodes())
+	{
+		for( const NumaNode& Node : Nodes )
+		{
+			const std::vector<int> Cpus = Node.Cpus;
+			const std::size_t Threads = Cpus.empty()
+				? std::thread::hardware_concurrency() : Cpus.size();
+			Pools.emplace_back(
+				new ThreadPool(
+					Threads ? Threads : 1,
+					[Cpus](std::size_t){ detail::PinToCpus(Cpus); }
+				)
+			);
+		}
+	}
+
+	std::size_t NodeCount() const
+	{
+		return Nodes.size();
+	}
+
+	const NumaNode& Node(std::size_t Index) const
+	{
+		return Nodes[Index];
+	}
+
+	// Index of the node with the designated id, or NodeCount() if it has no
+	// processors of its own
+	std::size_t NodeIndex(int Id) const
+	{
+		for( std::size_t Index = 0; Index < Nodes.size(); ++Index )
+		{
+			if( Nodes[Index].Id == Id )
+			{
+				return Index;
+			}
+		}
+		return Nodes.size();
+	}
+
+	// Calls Task once for every index in Tasks[k] on the workers of node k,
+	// with every node working at once, and returns once all calls have
+	// finished. The calling thread only waits, as it is not pinned anywhere.
+	void Run(
+		const std::vector<std::vector<std::size_t>>& Tasks,
+		const std::function<void(std::size_t)>& Task
+	)
+	{
+		std::mutex DoneMutex;
+		std::condition_variable DoneWake;
+		std::size_t Pending = 0;
+		std::vector<std::unique_ptr<std::atomic<std::size_t>>> Next;
+		for( std::size_t k = 0; k < Pools.size() && k < Tasks.size(); ++k )
+		{
+			Next.emplace_back(new std::atomic<std::size_t>(0));
+		}
+		{
+			std::lock_guard<std::mutex> Lock(DoneMutex);
+			for( std::size_t k = 0; k < Next.size(); ++k )
+			{
+				const std::size_t Helpers = Tasks[k].size()
+					< Pools[k]->ThreadCount()
+					? Tasks[k].size() : Pools[k]->ThreadCount();
+				Pending += Helpers;
+				std::atomic<std::size_t>* NodeNext = Next[k].get();
+				const std::vector<std::size_t>* NodeTasks = &Tasks[k];
+				for( std::size_t i = 0; i < Helpers; ++i )
+				{
+					Pools[k]->Submit(
+						[&, NodeNext, NodeTasks]()
+						{
+							for(
+								std::size_t t;
+								(t = NodeNext->fetch_add(1)) < NodeTasks->size();
+							)
+							{
+								Task((*NodeTasks)[t]);
+							}
+							std::lock_guard<std::mutex> Lock(DoneMutex);
+							if( --Pending == 0 )
+							{
+								DoneWake.notify_one();
+							}
+						}
+					);
+				}
+			}
+		}
+
+		std::unique_lock<std::mutex> Lock(DoneMutex);
+		DoneWake.wait(Lock, [&](){ return Pending == 0; });
+	}
+
+	// Hands each chunk to the node that holds the page at its address, and
+	// the chunks of pages without a node round-robin to all of them
+	std::vector<std::vector<std::size_t>> Assign(
+		std::vector<void*>& Pages, std::size_t PagesPerChunk
+	) const
+	{
+		const std::vector<int> Placement = detail::PageNodes(Pages);
+		std::vector<std::vector<std::size_t>> Tasks(Nodes.size());
+		const std::size_t ChunkCount = Pages.size() / PagesPerChunk;
+		for( std::size_t i = 0; i < ChunkCount; ++i )
+		{
+			std::size_t Index = Nodes.size();
+			for(
+				std::size_t p = 0; p < PagesPerChunk && Index == Nodes.size();
+				++p
+			)
+			{
+				const int Id = Placement[i * PagesPerChunk + p];
+				if( Id >= 0 )
+				{
+					Index = NodeIndex(Id);
+				}
+			}
+			Tasks[Index < Nodes.size() ? Index : i % Nodes.size()].push_back(i);
+		}
+		return Tasks;
+	}
+
+private:
+	std::vector<NumaNode> Nodes;
+	std::vector<std::unique_ptr<ThreadPool>> Pools;
+};
+
+} // namespace qreverse
+
+// Reverses the array like qReverseParallel, but with each mirrored pair of
+// chunks exchanged by the workers of the node that holds the head chunk's
+// memory, or the tail chunk's when the head has no node yet. Keeps at least
+// half of every pair's traffic local to its socket.
+template< std::size_t ElementSize >
+inline void qReverseParallelNuma(
+	void* Array, std::size_t Count, qreverse::NumaPool& Pool
+)
+{
+	if( Count * ElementSize < qreverse::ParallelThreshold )
+	{
+		qReverse<ElementSize>(Array, Count);
+		return;
+	}
+
+	const qreverse::ReverseProc Reverse =
+		qreverse::SelectReverseProc<ElementSize>();
+	const std::size_t Pairs = Count / 2;
+	const std::size_t Chunk = qreverse::ParallelChunkSize / ElementSize
+		? qreverse::ParallelChunkSize / ElementSize : 1;
+	const std::size_t ChunkCount = (Pairs + Chunk - 1) / Chunk;
+
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	std::vector<void*> Pages;
+	for( std::size_t i = 0; i < ChunkCount; ++i )
+	{
+		const std::size_t Begin = i * Chunk;
+		const std::size_t End = Begin + Chunk < Pairs ? Begin + Chunk : Pairs;
+		Pages.push_back(&Array8[Begin * ElementSize]);
+		Pages.push_back(&Array8[(Count - End) * ElementSize]);
+	}
+
+	Pool.Run(
+		Pool.Assign(Pages, 2),
+		[&](std::size_t i)
+		{
+			const std::size_t Begin = i * Chunk;
+			const std::size_t End = Begin + Chunk < Pairs ? Begin + Chunk : Pairs;
+			Reverse(Array, Count, Begin, End);
+		}
+	);
+}
+
+// Reverse-copies Src into Dst across the nodes of Pool. Each chunk of Dst is
+// written by the workers of the node that holds the chunk of Src it is read
+// from, so a freshly allocated Dst is first touched, and so placed, on the
+// same node as its source.
+template< std::size_t ElementSize >
+inline void qReverseCopyParallelNuma(
+	const void* Src, void* Dst, std::size_t Count, qreverse::NumaPool& Pool
+)
+{
+	if( Count * ElementSize < qreverse::ParallelThreshold )
+	{
+		qReverseCopy<ElementSize>(Src, Dst, Count);
+		return;
+	}
+
+	const qreverse::ReverseCopyProc ReverseCopy =
+		qreverse::SelectReverseCopyProc<ElementSize>();
+	const std::size_t Chunk = qreverse::ParallelChunkSize / ElementSize
+		? qreverse::ParallelChunkSize / ElementSize : 1;
+	const std::size_t ChunkCount = (Count + Chunk - 1) / Chunk;
+
+	const std::uint8_t* Src8 = reinterpret_cast<const std::uint8_t*>(Src);
+	std::uint8_t* Dst8 = reinterpret_cast<std::uint8_t*>(Dst);
+	std::vector<void*> Pages;
+	for( std::size_t i = 0; i < ChunkCount; ++i )
+	{
+		const std::size_t End = (i + 1) * Chunk < Count ? (i + 1) * Chunk : Count;
+		Pages.push_back(
+			const_cast<std::uint8_t*>(&Src8[(Count - End) * ElementSize])
+		);
+	}
+
+	Pool.Run(
+		Pool.Assign(Pages, 1),
+		[&](std::size_t i)
+		{
+			const std::size_t Begin = i * Chunk;
+			const std::size_t End = Begin + Chunk < Count ? Begin + Chunk : Count;
+			ReverseCopy(
+				&Src8[(Count - End) * ElementSize], &Dst8[Begin * ElementSize],
+				End - Begin
+			);
+		}
+	);
+}
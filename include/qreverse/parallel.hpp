@@ -0,0 +1,184 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <qreverse.hpp>
+
+namespace qreverse
+{
+
+// Arrays smaller than this many bytes are reversed on the calling thread,
+// where waking the workers would cost more than it saves
+constexpr std::size_t ParallelThreshold = 2u * 1024u * 1024u;
+
+// Bytes of each end of the array handed to a worker at a time. A mirrored
+// head/tail pair of chunks stays resident within a typical L2 cache.
+constexpr std::size_t ParallelChunkSize = 64u * 1024u;
+
+// A fixed set of worker threads that reversals may be split across
+class ThreadPool
+{
+public:
+	// Start, if any, is called on each worker with its index before it takes
+	// on any tasks, such as to pin it to a set of processors
+	explicit ThreadPool(
+		std::size_t Threads = std::thread::hardware_concurrency(),
+		std::function<void(std::size_t Worker)> Start = nullptr
+	)
+	{
+		for( std::size_t i = 0; i < Threads; ++i )
+		{
+			Workers.emplace_back(&ThreadPool::WorkerMain, this, i, Start);
+		}
+	}
+
+	~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			Stopping = true;
+		}
+		Wake.notify_all();
+		for( std::thread& Worker : Workers )
+		{
+			Worker.join();
+		}
+	}
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	std::size_t ThreadCount() const
+	{
+		return Workers.size();
+	}
+
+	// Queues a task to be run by the next idle worker
+	void Submit(std::function<void()> Task)
+	{
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			Tasks.push_back(std::move(Task));
+		}
+		Wake.notify_one();
+	}
+
+	// Calls Task once for every index in [0, TaskCount), spread across the
+	// workers and the calling thread, and returns once all calls have finished.
+	// Must not be called from within one of the pool's own tasks.
+	void Run(std::size_t TaskCount, const std::function<void(std::size_t)>& Task)
+	{
+		std::atomic<std::size_t> Next(0);
+		const auto Work = [&]()
+		{
+			for( std::size_t i; (i = Next.fetch_add(1)) < TaskCount; )
+			{
+				Task(i);
+			}
+		};
+
+		// The calling thread takes part too, so one less helper is needed
+		std::size_t Helpers = TaskCount ? TaskCount - 1 : 0;
+		if( Helpers > ThreadCount() )
+		{
+			Helpers = ThreadCount();
+		}
+
+		std::mutex DoneMutex;
+		std::condition_variable DoneWake;
+		std::size_t Pending = Helpers;
+		for( std::size_t i = 0; i < Helpers; ++i )
+		{
+			Submit(
+				[&]()
+				{
+					Work();
+					std::lock_guard<std::mutex> Lock(DoneMutex);
+					if( --Pending == 0 )
+					{
+						DoneWake.notify_one();
+					}
+				}
+			);
+		}
+
+		Work();
+
+		std::unique_lock<std::mutex> Lock(DoneMutex);
+		DoneWake.wait(Lock, [&](){ return Pending == 0; });
+	}
+
+private:
+	void WorkerMain(
+		std::size_t Worker, std::function<void(std::size_t)> Start
+	)
+	{
+		if( Start )
+		{
+			Start(Worker);
+		}
+		for( ;; )
+		{
+			std::function<void()> Task;
+			{
+				std::unique_lock<std::mutex> Lock(Mutex);
+				Wake.wait(Lock, [this](){ return Stopping || !Tasks.empty(); });
+				if( Tasks.empty() )
+				{
+					return;
+				}
+				Task = std::move(Tasks.front());
+				Tasks.pop_front();
+			}
+			Task();
+		}
+	}
+
+	std::vector<std::thread> Workers;
+	std::deque<std::function<void()>> Tasks;
+	std::mutex Mutex;
+	std::condition_variable Wake;
+	bool Stopping = false;
+};
+
+} // namespace qreverse
+
+// Reverses the array across the threads of Pool. The lower half of the array
+// is split into chunks and each worker exchanges one chunk with its mirrored
+// chunk in the upper half using the same kernels as qReverse.
+template< std::size_t ElementSize >
+inline void qReverseParallel(
+	void* Array, std::size_t Count, qreverse::ThreadPool& Pool
+)
+{
+	if( Count * ElementSize < qreverse::ParallelThreshold || !Pool.ThreadCount() )
+	{
+		qReverse<ElementSize>(Array, Count);
+		return;
+	}
+
+	const qreverse::ReverseProc Reverse =
+		qreverse::SelectReverseProc<ElementSize>();
+	const std::size_t Pairs = Count / 2;
+	const std::size_t Chunk = qreverse::ParallelChunkSize / ElementSize
+		? qreverse::ParallelChunkSize / ElementSize : 1;
+	const std::size_t ChunkCount = (Pairs + Chunk - 1) / Chunk;
+
+	Pool.Run(
+		ChunkCount,
+		[&](std::size_t i)
+		{
+			const std::size_t Begin = i * Chunk;
+			const std::size_t End = Begin + Chunk < Pairs ? Begin + Chunk : Pairs;
+			Reverse(Array, Count, Begin, End);
+		}
+	);
+}
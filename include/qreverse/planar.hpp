@@ -0,0 +1,272 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include <qreverse.hpp>
+
+namespace qreverse
+{
+
+// Writes Count interleaved frames of PlaneCount ElementSize-byte elements from
+// Src into the PlaneCount arrays of Planes in reverse order, so that element i
+// of plane k is element k of frame Count - i - 1
+using ReverseDeinterleaveProc = void(*)(
+	const void* Src, void* const* Planes, std::size_t PlaneCount,
+	std::size_t Count
+);
+
+namespace detail
+{
+
+// Bytes of each end of each plane exchanged before moving on to the next
+// plane. Keeps every plane's pair of streams in step while the pairs of all of
+// the planes stay resident in L1/L2 between them.
+constexpr std::size_t PlaneChunkSize = 4096;
+
+/// Deinterleave steps
+// Each step writes the elements of output frames i onward for as long as its
+// vector width still fits, returning the index of the first frame it left
+
+template< std::size_t ElementSize >
+inline void ReverseDeinterleaveSerial(
+	const void* Src, void* const* Planes, std::size_t PlaneCount,
+	std::size_t Count, std::size_t i
+)
+{
+	const std::uint8_t* Src8 = reinterpret_cast<const std::uint8_t*>(Src);
+	const std::size_t FrameSize = ElementSize * PlaneCount;
+	for( ; i < Count; ++i )
+	{
+		const std::uint8_t* Frame = &Src8[(Count - i - 1) * FrameSize];
+		for( std::size_t k = 0; k < PlaneCount; ++k )
+		{
+			std::uint8_t* Plane8 = reinterpret_cast<std::uint8_t*>(Planes[k]);
+			std::memcpy(
+				&Plane8[i * ElementSize], &Frame[k * ElementSize], ElementSize
+			);
+		}
+	}
+}
+
+#if defined(QREVERSE_X86)
+// SSSE3
+// Registers that each hold a run of every plane side by side, in the order of
+// the planes, are transposed into registers that each hold one plane
+QREVERSE_TARGET_SSSE3
+inline void TransposeRuns(__m128i (&Runs)[2])
+{
+	const __m128i Lower = Runs[0];
+	Runs[0] = _mm_unpacklo_epi64(Lower, Runs[1]);
+	Runs[1] = _mm_unpackhi_epi64(Lower, Runs[1]);
+}
+
+QREVERSE_TARGET_SSSE3
+inline void TransposeRuns(__m128i (&Runs)[4])
+{
+	const __m128i Lower01 = _mm_unpacklo_epi32(Runs[0], Runs[1]);
+	const __m128i Lower23 = _mm_unpacklo_epi32(Runs[2], Runs[3]);
+	const __m128i Upper01 = _mm_unpackhi_epi32(Runs[0], Runs[1]);
+	const __m128i Upper23 = _mm_unpackhi_epi32(Runs[2], Runs[3]);
+	Runs[0] = _mm_unpacklo_epi64(Lower01, Lower23);
+	Runs[1] = _mm_unpackhi_epi64(Lower01, Lower23);
+	Runs[2] = _mm_unpacklo_epi64(Upper01, Upper23);
+	Runs[3] = _mm_unpackhi_epi64(Upper01, Upper23);
+}
+
+// A single shuffle reverses the frames of a register while gathering the
+// elements of each plane into a run of 16 / PlaneCount bytes. PlaneCount such
+// registers are then transposed so that each plane is written a whole register
+// at a time. Takes the frame sizes that evenly divide a register.
+template< std::size_t ElementSize, std::size_t PlaneCount >
+QREVERSE_TARGET_SSSE3
+inline std::size_t ReverseDeinterleaveSSSE3(
+	const void* Src, void* const* Planes, std::size_t Count, std::size_t i
+)
+{
+	constexpr std::size_t FrameSize = ElementSize * PlaneCount;
+	if( 16 % FrameSize )
+	{
+		return i;
+	}
+	// Frames per register, and bytes of each plane within it
+	constexpr std::size_t Frames = 16 % FrameSize ? 1 : 16 / FrameSize;
+	constexpr std::size_t Run = 16 / PlaneCount;
+	// Elements of each plane written per iteration
+	constexpr std::size_t Width = 16 / ElementSize;
+
+	alignas(16) std::uint8_t Shuffle[16];
+	for( std::size_t Byte = 0; Byte < 16; ++Byte )
+	{
+		const std::size_t Plane = Byte / Run;
+		const std::size_t Frame = (Byte % Run) / ElementSize;
+		Shuffle[Byte] = static_cast<std::uint8_t>(
+			(Frames - Frame - 1) * FrameSize + Plane * ElementSize
+			+ Byte % ElementSize
+		);
+	}
+	const __m128i ShuffleRev = _mm_load_si128(
+		reinterpret_cast<const __m128i*>(Shuffle)
+	);
+
+	const std::uint8_t* Src8 = reinterpret_cast<const std::uint8_t*>(Src);
+	for( ; i + Width <= Count; i += Width )
+	{
+		__m128i Runs[PlaneCount];
+		for( std::size_t r = 0; r < PlaneCount; ++r )
+		{
+			Runs[r] = _mm_shuffle_epi8(
+				_mm_loadu_si128(
+					reinterpret_cast<const __m128i*>(
+						&Src8[(Count - i - (r + 1) * Frames) * FrameSize]
+					)
+				),
+				ShuffleRev
+			);
+		}
+		TransposeRuns(Runs);
+		for( std::size_t k = 0; k < PlaneCount; ++k )
+		{
+			std::uint8_t* Plane8 = reinterpret_cast<std::uint8_t*>(Planes[k]);
+			_mm_storeu_si128(
+				reinterpret_cast<__m128i*>(&Plane8[i * ElementSize]), Runs[k]
+			);
+		}
+	}
+	return i;
+}
+#endif
+
+/// Deinterleave kernels
+
+template< std::size_t ElementSize >
+void ReverseDeinterleaveKernelSerial(
+	const void* Src, void* const* Planes, std::size_t PlaneCount,
+	std::size_t Count
+)
+{
+	ReverseDeinterleaveSerial<ElementSize>(Src, Planes, PlaneCount, Count, 0);
+}
+
+#if defined(QREVERSE_X86)
+template< std::size_t ElementSize >
+QREVERSE_TARGET_SSSE3
+void ReverseDeinterleaveKernelSSSE3(
+	const void* Src, void* const* Planes, std::size_t PlaneCount,
+	std::size_t Count
+)
+{
+	std::size_t i = 0;
+	// Plane counts are only known at run-time, the shuffles for the common
+	// ones are instantiated ahead of time
+	switch( PlaneCount )
+	{
+	case 2:
+		i = ReverseDeinterleaveSSSE3<ElementSize, 2>(Src, Planes, Count, i);
+		break;
+	case 4:
+		i = ReverseDeinterleaveSSSE3<ElementSize, 4>(Src, Planes, Count, i);
+		break;
+	}
+	ReverseDeinterleaveSerial<ElementSize>(Src, Planes, PlaneCount, Count, i);
+}
+#endif
+
+} // namespace detail
+
+template< std::size_t ElementSize >
+inline ReverseDeinterleaveProc GetReverseDeinterleaveProc(Tier Level)
+{
+	static const ReverseDeinterleaveProc
+		Procs[static_cast<std::size_t>(Tier::Count)] = {
+		detail::ReverseDeinterleaveKernelSerial<ElementSize>,
+		detail::ReverseDeinterleaveKernelSerial<ElementSize>,
+#if defined(QREVERSE_X86)
+		detail::ReverseDeinterleaveKernelSSSE3<ElementSize>,
+#else
+		nullptr,
+#endif
+		// The NEON and SVE tiers have no deinterleaving shuffles of their own
+		// yet
+#if defined(QREVERSE_NEON)
+		detail::ReverseDeinterleaveKernelSerial<ElementSize>,
+#else
+		nullptr,
+#endif
+		// The wider tiers would have to cross lanes to gather the planes
+#if defined(QREVERSE_X86)
+		detail::ReverseDeinterleaveKernelSSSE3<ElementSize>,
+		detail::ReverseDeinterleaveKernelSSSE3<ElementSize>,
+		detail::ReverseDeinterleaveKernelSSSE3<ElementSize>,
+#else
+		nullptr,
+		nullptr,
+		nullptr,
+#endif
+#if defined(QREVERSE_SVE)
+		detail::ReverseDeinterleaveKernelSerial<ElementSize>,
+#else
+		nullptr,
+#endif
+	};
+	if( Level >= Tier::Count || !TierSupported(Level) )
+	{
+		return nullptr;
+	}
+	return Procs[static_cast<std::size_t>(Level)];
+}
+
+template< std::size_t ElementSize >
+inline ReverseDeinterleaveProc SelectReverseDeinterleaveProc()
+{
+	static const ReverseDeinterleaveProc Proc =
+		GetReverseDeinterleaveProc<ElementSize>(HighestTier());
+	return Proc;
+}
+
+} // namespace qreverse
+
+// Reverses PlaneCount arrays of Count elements each in-place, such as the
+// channels of planar audio. The planes are reversed together a chunk of each
+// end at a time rather than one after another, so their head and tail
+// pointers advance in step.
+template< std::size_t ElementSize >
+inline void qReversePlanes(
+	void* const* Planes, std::size_t PlaneCount, std::size_t Count
+)
+{
+	const qreverse::ReverseProc Reverse =
+		qreverse::SelectReverseProc<ElementSize>();
+	const std::size_t Pairs = Count / 2;
+	const std::size_t Chunk = qreverse::detail::PlaneChunkSize / ElementSize
+		? qreverse::detail::PlaneChunkSize / ElementSize : 1;
+	for( std::size_t Begin = 0; Begin < Pairs; Begin += Chunk )
+	{
+		const std::size_t End = Pairs - Begin < Chunk ? Pairs : Begin + Chunk;
+		for( std::size_t k = 0; k < PlaneCount; ++k )
+		{
+			Reverse(Planes[k], Count, Begin, End);
+		}
+	}
+}
+
+// Reverses Count interleaved frames of PlaneCount elements, such as the
+// samples of interleaved audio, while splitting them into separate planes.
+// Element i of plane k is element k of frame Count - i - 1 of Src. None of the
+// planes may overlap Src or one another.
+template< std::size_t ElementSize >
+inline void qReverseDeinterleave(
+	const void* Src, void* const* Planes, std::size_t PlaneCount,
+	std::size_t Count
+)
+{
+	// A single plane is nothing more than a reversed copy
+	if( PlaneCount == 1 )
+	{
+		qReverseCopy<ElementSize>(Src, Planes[0], Count);
+		return;
+	}
+	qreverse::SelectReverseDeinterleaveProc<ElementSize>()(
+		Src, Planes, PlaneCount, Count
+	);
+}
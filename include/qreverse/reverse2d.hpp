@@ -0,0 +1,144 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include <qreverse.hpp>
+
+namespace qreverse
+{
+
+// Which way qReverse2D mirrors an image
+enum class Axis : std::uint8_t
+{
+	Horizontal = 0, // Reverse the elements within each row
+	Vertical,       // Reverse the order of the rows
+	Both,           // Both at once, a rotation by 180 degrees
+};
+
+namespace detail
+{
+
+// Bytes of a row pair exchanged at a time. Small enough that the staging
+// buffer and both halves being exchanged stay resident in L1.
+constexpr std::size_t RowBlockSize = 4096;
+
+// Exchanges two non-overlapping byte ranges through a staging buffer, leaving
+// the actual moves to memcpy which already uses the widest vectors available
+inline void SwapRows(void* RowA, void* RowB, std::size_t Size)
+{
+	std::uint8_t* RowA8 = reinterpret_cast<std::uint8_t*>(RowA);
+	std::uint8_t* RowB8 = reinterpret_cast<std::uint8_t*>(RowB);
+	std::uint8_t Block[RowBlockSize];
+	for( std::size_t i = 0; i < Size; i += RowBlockSize )
+	{
+		const std::size_t Bytes =
+			Size - i < RowBlockSize ? Size - i : RowBlockSize;
+		std::memcpy(Block, &RowA8[i], Bytes);
+		std::memcpy(&RowA8[i], &RowB8[i], Bytes);
+		std::memcpy(&RowB8[i], Block, Bytes);
+	}
+}
+
+// Exchanges two non-overlapping rows of Width elements while reversing both,
+// so that element i of one row ends up at Width - i - 1 of the other
+template< std::size_t ElementSize >
+inline void SwapReverseRows(void* RowA, void* RowB, std::size_t Width)
+{
+	const ReverseCopyProc ReverseCopy = SelectReverseCopyProc<ElementSize>();
+	std::uint8_t* RowA8 = reinterpret_cast<std::uint8_t*>(RowA);
+	std::uint8_t* RowB8 = reinterpret_cast<std::uint8_t*>(RowB);
+	std::uint8_t Block[RowBlockSize];
+	// Elements per block
+	const std::size_t BlockWidth = RowBlockSize / ElementSize
+		? RowBlockSize / ElementSize : 1;
+	if( BlockWidth * ElementSize > RowBlockSize )
+	{
+		// Elements too large to be staged are exchanged through the rows
+		// themselves
+		for( std::size_t i = 0; i < Width; ++i )
+		{
+			SwapRows(
+				&RowA8[i * ElementSize],
+				&RowB8[(Width - i - 1) * ElementSize],
+				ElementSize
+			);
+		}
+		return;
+	}
+	for( std::size_t i = 0; i < Width; i += BlockWidth )
+	{
+		const std::size_t Count =
+			Width - i < BlockWidth ? Width - i : BlockWidth;
+		// The block of RowB that mirrors [i, i + Count) of RowA
+		std::uint8_t* MirrorB = &RowB8[(Width - i - Count) * ElementSize];
+		ReverseCopy(&RowA8[i * ElementSize], Block, Count);
+		ReverseCopy(MirrorB, &RowA8[i * ElementSize], Count);
+		std::memcpy(MirrorB, Block, Count * ElementSize);
+	}
+}
+
+} // namespace detail
+
+} // namespace qreverse
+
+// Mirrors a Width by Height image of ElementSize-byte elements in-place. Rows
+// start RowPitch bytes apart, which must be at least Width * ElementSize.
+template< std::size_t ElementSize >
+inline void qReverse2D(
+	void* Base, std::size_t Width, std::size_t Height, std::size_t RowPitch,
+	qreverse::Axis Axis
+)
+{
+	std::uint8_t* Base8 = reinterpret_cast<std::uint8_t*>(Base);
+	const std::size_t RowSize = Width * ElementSize;
+
+	switch( Axis )
+	{
+	case qreverse::Axis::Horizontal:
+	{
+		const qreverse::ReverseProc Reverse =
+			qreverse::SelectReverseProc<ElementSize>();
+		for( std::size_t y = 0; y < Height; ++y )
+		{
+			Reverse(&Base8[y * RowPitch], Width, 0, Width / 2);
+		}
+		break;
+	}
+	case qreverse::Axis::Vertical:
+	{
+		for( std::size_t y = 0; y < Height / 2; ++y )
+		{
+			qreverse::detail::SwapRows(
+				&Base8[y * RowPitch],
+				&Base8[(Height - y - 1) * RowPitch],
+				RowSize
+			);
+		}
+		break;
+	}
+	case qreverse::Axis::Both:
+	{
+		// Rows without any padding between them are one contiguous array
+		if( RowPitch == RowSize )
+		{
+			qReverse<ElementSize>(Base, Width * Height);
+			break;
+		}
+		for( std::size_t y = 0; y < Height / 2; ++y )
+		{
+			qreverse::detail::SwapReverseRows<ElementSize>(
+				&Base8[y * RowPitch],
+				&Base8[(Height - y - 1) * RowPitch],
+				Width
+			);
+		}
+		// An odd row out in the middle only has to be mirrored
+		if( Height % 2 )
+		{
+			qReverse<ElementSize>(&Base8[(Height / 2) * RowPitch], Width);
+		}
+		break;
+	}
+	}
+}
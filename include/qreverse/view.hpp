@@ -0,0 +1,122 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include <qreverse.hpp>
+
+namespace qreverse
+{
+
+// Bytes of the reversed order materialized at a time, and how many such tiles
+// a view keeps around. Tiles are small enough for the cache to stay within
+// L1/L2 while still amortizing the kernel entry of each fill.
+constexpr std::size_t ViewTileSize = 4096;
+constexpr std::size_t ViewTileCount = 4;
+
+// Presents an array in reverse order without modifying it. Reads go through
+// the reverse-copy kernels, either straight into the caller's buffer with
+// CopyOut or into a small cache of tiles for element and block access, so
+// the work done is proportional to the elements read rather than to the size
+// of the array. The array must outlive the view and not change while it has
+// tiles of it cached.
+template< std::size_t ElementSize >
+class ReversedView
+{
+public:
+	ReversedView(const void* Array, std::size_t Count)
+		: Array(reinterpret_cast<const std::uint8_t*>(Array)), Count(Count),
+		TileElements(
+			ViewTileSize / ElementSize ? ViewTileSize / ElementSize : 1
+		)
+	{
+		for( std::size_t k = 0; k < ViewTileCount; ++k )
+		{
+			Tags[k] = NoTile;
+		}
+	}
+
+	std::size_t Size() const
+	{
+		return Count;
+	}
+
+	// Writes Length elements of the reversed order starting at Offset to Dst
+	void CopyOut(std::size_t Offset, std::size_t Length, void* Dst) const
+	{
+		if( !Length )
+		{
+			return;
+		}
+		SelectReverseCopyProc<ElementSize>()(
+			&Array[(Count - Offset - Length) * ElementSize], Dst, Length
+		);
+	}
+
+	// The run of the reversed order that holds element Index, valid until
+	// the next call that fills a tile. Length is set to the elements of the
+	// run from Index onward, which never crosses the end of the view.
+	const void* Block(std::size_t Index, std::size_t& Length)
+	{
+		const std::size_t Tile = Index / TileElements;
+		const std::size_t First = Tile * TileElements;
+		const std::size_t End = Count - First < TileElements
+			? Count : First + TileElements;
+		Length = End - Index;
+		return &Fill(Tile, First, End)[(Index - First) * ElementSize];
+	}
+
+	// Element Index of the reversed order, valid until the next call that
+	// fills a tile
+	const void* At(std::size_t Index)
+	{
+		std::size_t Length;
+		return Block(Index, Length);
+	}
+
+private:
+	static constexpr std::size_t NoTile = ~std::size_t(0);
+
+	// Returns the tile of reversed elements [First, End), reversing it into
+	// the least recently filled slot if it is not cached yet
+	const std::uint8_t* Fill(
+		std::size_t Tile, std::size_t First, std::size_t End
+	)
+	{
+		const std::size_t TileBytes = TileElements * ElementSize;
+		for( std::size_t k = 0; k < ViewTileCount; ++k )
+		{
+			if( Tags[k] == Tile )
+			{
+				return &Tiles[k * TileBytes];
+			}
+		}
+		if( Tiles.empty() )
+		{
+			Tiles.resize(ViewTileCount * TileBytes);
+		}
+		const std::size_t Slot = Next;
+		Next = (Next + 1) % ViewTileCount;
+		Tags[Slot] = Tile;
+		CopyOut(First, End - First, &Tiles[Slot * TileBytes]);
+		return &Tiles[Slot * TileBytes];
+	}
+
+	const std::uint8_t* Array;
+	std::size_t Count;
+	std::size_t TileElements;
+	std::vector<std::uint8_t> Tiles;
+	std::size_t Tags[ViewTileCount];
+	std::size_t Next = 0;
+};
+
+} // namespace qreverse
+
+// A view of the array in reverse order that only reverses what is read of it
+template< std::size_t ElementSize >
+inline qreverse::ReversedView<ElementSize> qReversedView(
+	const void* Array, std::size_t Count
+)
+{
+	return qreverse::ReversedView<ElementSize>(Array, Count);
+}
@@ -0,0 +1,87 @@
+#define QREVERSE_BUILD
+#include <qreverse.h>
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+#include <qreverse.hpp>
+
+/*
+Exported C entry points of the qreverse library. Every kernel is compiled
+into the library through the target attributes of qreverse.hpp, and the tier
+is picked at run-time upon the first call for each element size.
+*/
+
+void qreverse_u8(void* Array, size_t Count)
+{
+	qReverse<1>(Array, Count);
+}
+
+void qreverse_u16(void* Array, size_t Count)
+{
+	qReverse<2>(Array, Count);
+}
+
+void qreverse_u32(void* Array, size_t Count)
+{
+	qReverse<4>(Array, Count);
+}
+
+void qreverse_u64(void* Array, size_t Count)
+{
+	qReverse<8>(Array, Count);
+}
+
+void qreverse_u128(void* Array, size_t Count)
+{
+	qReverse<16>(Array, Count);
+}
+
+void qreverse_n(void* Array, size_t Count, size_t ElementSize)
+{
+	switch( ElementSize )
+	{
+	case 0:
+		return;
+	case 1:
+		return qReverse<1>(Array, Count);
+	case 2:
+		return qReverse<2>(Array, Count);
+	case 3:
+		return qReverse<3>(Array, Count);
+	case 4:
+		return qReverse<4>(Array, Count);
+	case 5:
+		return qReverse<5>(Array, Count);
+	case 6:
+		return qReverse<6>(Array, Count);
+	case 7:
+		return qReverse<7>(Array, Count);
+	case 8:
+		return qReverse<8>(Array, Count);
+	case 12:
+		return qReverse<12>(Array, Count);
+	case 16:
+		return qReverse<16>(Array, Count);
+	case 24:
+		return qReverse<24>(Array, Count);
+	case 32:
+		return qReverse<32>(Array, Count);
+	case 48:
+		return qReverse<48>(Array, Count);
+	case 64:
+		return qReverse<64>(Array, Count);
+	case 128:
+		return qReverse<128>(Array, Count);
+	}
+	// Element sizes only known at run-time are exchanged a byte range at a time
+	std::uint8_t* Array8 = reinterpret_cast<std::uint8_t*>(Array);
+	for( std::size_t i = 0; i < Count / 2; ++i )
+	{
+		std::swap_ranges(
+			&Array8[i * ElementSize], &Array8[(i + 1) * ElementSize],
+			&Array8[(Count - i - 1) * ElementSize]
+		);
+	}
+}
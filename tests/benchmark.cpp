@@ -1,167 +1,798 @@
-#include <cstddef>
-#include <cstdint>
-#include <cmath>
-#include <cstdio>
-#include <iostream>
-#include <iomanip>
-
-#include <algorithm>
-#include <numeric>
-#include <array>
-#include <vector>
-#include <functional>
-
-#include <chrono>
-
-#include <qreverse.hpp>
-
-/*
-For use with cmake:
-	Benchmarks qreverse against std::reverse at the designated
-	compile-time element size.
-
-	Define ELEMENTSIZE preprocessor value to adjust verified element size
-*/
-
-#ifndef ELEMENTSIZE
-#define ELEMENTSIZE 1
-#endif
-
-#define TRIALCOUNT 10000
-
-template<typename TimeT = std::chrono::nanoseconds>
-struct Measure
-{
-	template<typename F, typename ...Args>
-	static typename TimeT::rep Execute(F&& func, Args&&... args)
-	{
-		auto start = std::chrono::high_resolution_clock::now();
-		std::forward<decltype(func)>(func)(std::forward<Args>(args)...);
-		auto duration = std::chrono::duration_cast<TimeT>(
-			std::chrono::high_resolution_clock::now() - start
-		);
-		return duration.count();
-	}
-
-	template<typename F, typename ...Args>
-	static TimeT Duration(F&& func, Args&&... args)
-	{
-		auto start = std::chrono::high_resolution_clock::now();
-		std::forward<decltype(func)>(func)(std::forward<Args>(args)...);
-		return std::chrono::duration_cast<TimeT>(
-			std::chrono::high_resolution_clock::now() - start
-		);
-	}
-};
-
-template< std::size_t ElementSize, std::size_t Count >
-void Bench()
-{
-	std::size_t SpeedStd = 0;
-	std::size_t SpeedQrev = 0;
-
-	// Compile-time generic structure used to benchmark an AoS of this size
-	struct ElementType
-	{
-		std::uint8_t u8[ElementSize];
-	};
-
-	// If compiler adds any padding/alignment bytes(and some do) then assert out
-	static_assert(
-		sizeof(ElementType) == ElementSize,
-		"ElementSize is pad-aligned and does not match specified element size"
-	);
-
-	std::vector<ElementType> Array(Count);
-
-	std::chrono::nanoseconds Duration;
-
-	/// std::reverse
-	Duration = std::chrono::nanoseconds::zero();
-	for( std::size_t i = 0; i < TRIALCOUNT; i++ )
-	{
-		Duration += Measure<>::Duration(
-			std::reverse<decltype(Array.begin())>,
-			Array.begin(),
-			Array.end()
-		);
-	}
-	Duration /= TRIALCOUNT;
-	SpeedStd = Duration.count();
-
-	/// qreverse
-	Duration = std::chrono::nanoseconds::zero();
-	for( std::size_t i = 0; i < TRIALCOUNT; i++ )
-	{
-		Duration += Measure<>::Duration(
-			qReverse<sizeof(ElementType)>,
-			Array.data(),
-			Array.size()
-		);
-	}
-	Duration /= TRIALCOUNT;
-	SpeedQrev = Duration.count();
-
-	std::double_t SpeedUp =
-		SpeedStd / static_cast<std::double_t>(SpeedQrev);
-
-	std::cout
-		<< Count << '|'
-		<< SpeedStd << " ns|"
-		<< SpeedQrev << " ns|"
-		<< (SpeedUp > 1.0 ? "**" : "*")
-		<< SpeedUp
-		<< (SpeedUp > 1.0 ? "**" : "*")
-		<< std::endl;
-
-	return;
-}
-
-int main()
-{
-	/// Benchmark
-	std::cout << std::fixed << std::setprecision(3);
-
-	std::cout
-		<< "Element Count" << '|'
-		<< "std::reverse" << '|'
-		<< "qReverse" << '|'
-		<< "Speedup Factor"
-		<< std::endl;
-
-	std::cout
-		<< "---|" // Element count
-		<< "---|" // std::reverse
-		<< "---|" // qReverse
-		<< "---" // Speedup
-		<< std::endl;
-
-	// Powers of two
-	Bench< ELEMENTSIZE, 8 >();
-	Bench< ELEMENTSIZE, 16 >();
-	Bench< ELEMENTSIZE, 32 >();
-	Bench< ELEMENTSIZE, 64 >();
-	Bench< ELEMENTSIZE, 128 >();
-	Bench< ELEMENTSIZE, 256 >();
-	Bench< ELEMENTSIZE, 512 >();
-	Bench< ELEMENTSIZE, 1024 >();
-
-	// Powers of ten
-	Bench< ELEMENTSIZE, 100 >();
-	Bench< ELEMENTSIZE, 1000 >();
-	Bench< ELEMENTSIZE, 10000 >();
-	Bench< ELEMENTSIZE, 100000 >();
-	Bench< ELEMENTSIZE, 1000000 >();
-
-	// Primes
-	Bench< ELEMENTSIZE, 59 >();
-	Bench< ELEMENTSIZE, 79 >();
-	Bench< ELEMENTSIZE, 173 >();
-	Bench< ELEMENTSIZE, 6133 >();
-	Bench< ELEMENTSIZE, 10177 >();
-	Bench< ELEMENTSIZE, 25253 >();
-	Bench< ELEMENTSIZE, 31391 >();
-	Bench< ELEMENTSIZE, 50432 >();
-
-	return EXIT_SUCCESS;
-}
\ No newline at end of file
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+
+#include <algorithm>
+#include <numeric>
+#include <array>
+#include <string>
+#include <vector>
+#include <functional>
+
+#include <chrono>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <qreverse/hugepage.hpp>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+
+#include <qreverse.hpp>
+
+/*
+For use with cmake:
+	Benchmarks qreverse against std::reverse at the designated
+	compile-time element size.
+
+	Define ELEMENTSIZE preprocessor value to adjust verified element size
+
+	Usage: Benchmark# [offsets|tiers|pages] [Options] [Element Count...]
+
+	Without any element counts a default set of powers of two, powers of ten,
+	and primes is measured. Run with "offsets" to instead measure every
+	base-pointer offset within a cache line at each element count, 10000 by
+	default. Run with "tiers" to measure the kernel of every tier the machine
+	supports, each forced on its own, along with a report of the element
+	count from which each tier beats all of the tiers below it. Run with
+	"pages" to measure qReverse over arrays of 4KiB pages against arrays of
+	the largest huge pages the kernel hands out, at 4MiB, 64MiB and 256MiB
+	by default. Only available on Linux.
+
+	Options:
+		--format=markdown|json|csv  Output format, markdown by default
+		--cache=hot|cold            Reverse one buffer over and over, or cycle
+		                            through buffers larger than the last level
+		                            cache so that each call starts out cold
+		--pin=CPU                   Pin the benchmark to a CPU before measuring
+		--samples=N                 Number of timed batches, 101 by default
+
+	The tier crossover report is part of the markdown and JSON output.
+
+	Each sample times a batch of calls long enough for the clock overhead to
+	vanish and reports the time per call. Throughput counts every byte of the
+	array once per call.
+*/
+
+#ifndef ELEMENTSIZE
+#define ELEMENTSIZE 1
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+// Calls to the kernel before any sample is taken
+const std::chrono::milliseconds WarmupTime(10);
+
+// Shortest batch that is timed as a single sample
+const std::chrono::microseconds MinBatchTime(20);
+
+// Cold-cache runs cycle through at least this many bytes of buffers, which is
+// larger than the last-level cache of the machines we measure on
+const std::size_t ColdSetSize = 64 * 1024 * 1024;
+
+enum class Format
+{
+	Markdown,
+	JSON,
+	CSV,
+};
+
+struct Options
+{
+	Format Output = Format::Markdown;
+	bool Cold = false;
+	bool Offsets = false;
+	bool Tiers = false;
+	bool Pages = false;
+	int Pin = -1;
+	std::size_t Samples = 101;
+	std::vector<std::size_t> Counts;
+};
+
+using Kernel = void(*)(void* Array, std::size_t Count);
+
+template< std::size_t ElementSize >
+void StdReverse(void* Array, std::size_t Count)
+{
+	// Compile-time generic structure used to benchmark an AoS of this size
+	struct ElementType
+	{
+		std::uint8_t u8[ElementSize];
+	};
+
+	// If compiler adds any padding/alignment bytes(and some do) then assert out
+	static_assert(
+		sizeof(ElementType) == ElementSize,
+		"ElementSize is pad-aligned and does not match specified element size"
+	);
+
+	ElementType* ArrayN = reinterpret_cast<ElementType*>(Array);
+	std::reverse(ArrayN, ArrayN + Count);
+}
+
+// Runs the kernel of a single tier regardless of what the machine supports
+// beyond it
+template< std::size_t ElementSize, qreverse::Tier Level >
+void ForcedReverse(void* Array, std::size_t Count)
+{
+	static const qreverse::ReverseProc Proc =
+		qreverse::GetReverseProc<ElementSize>(Level);
+	Proc(Array, Count, 0, Count / 2);
+}
+
+// Nanoseconds per call
+struct Stats
+{
+	std::double_t Min;
+	std::double_t Median;
+	std::double_t P99;
+};
+
+// Smallest element count from which a tier beats every tier below it at all
+// larger counts, or zero if it never does
+struct Crossover
+{
+	std::string Kernel;
+	std::size_t Count;
+};
+
+struct Result
+{
+	std::string Kernel;
+	std::size_t Count;
+	std::size_t Offset;
+	qreverse::Alignment Align;
+	Stats Time;
+	// Of the first kernel measured at the same count and offset
+	std::double_t Speedup;
+};
+
+// Cache-line aligned arrays to run a kernel over. Hot runs keep reusing the
+// first slot while cold runs walk through all of them.
+class Workspace
+{
+public:
+	Workspace(std::size_t Size, bool Cold)
+	{
+		Layout(Size, Cold);
+		Arena.resize(Slots * Stride + 64);
+		Base = Arena.data() + (
+			64 - reinterpret_cast<std::uintptr_t>(Arena.data()) % 64
+		);
+	}
+
+#if defined(__linux__)
+	// Arrays within a mapping of the largest pages up to Largest instead. The
+	// mapping is page aligned, which keeps the arrays cache-line aligned.
+	Workspace(std::size_t Size, bool Cold, qreverse::PageBacking Largest)
+	{
+		Layout(Size, Cold);
+		Pages = qreverse::HugeBuffer(Slots * Stride, Largest);
+		Base = reinterpret_cast<std::uint8_t*>(Pages.Data());
+	}
+
+	qreverse::PageBacking Backing() const
+	{
+		return Pages.Backing();
+	}
+#endif
+
+	std::uint8_t* Slot(std::size_t Index)
+	{
+		return Base + (Index % Slots) * Stride;
+	}
+
+	std::size_t Stride;
+	std::size_t Slots;
+
+private:
+	void Layout(std::size_t Size, bool Cold)
+	{
+		// Leaves room to start an array anywhere within its first cache line
+		Stride = (Size + 64 + 63) / 64 * 64;
+		Slots = Cold ? std::max<std::size_t>(ColdSetSize / Stride, 2) : 1;
+	}
+
+	std::vector<std::uint8_t> Arena;
+#if defined(__linux__)
+	qreverse::HugeBuffer Pages;
+#endif
+	std::uint8_t* Base;
+};
+
+// Runs Calls calls to the kernel starting at slot Next, returning the time it
+// took in nanoseconds
+inline std::double_t RunBatch(
+	Kernel Func, Workspace& Work, std::size_t& Next, std::size_t Offset,
+	std::size_t Count, std::size_t Calls
+)
+{
+	const Clock::time_point Start = Clock::now();
+	for( std::size_t i = 0; i < Calls; ++i )
+	{
+		Func(Work.Slot(Next++) + Offset, Count);
+	}
+	return std::chrono::duration<std::double_t, std::nano>(
+		Clock::now() - Start
+	).count();
+}
+
+Stats Measure(
+	Kernel Func, Workspace& Work, std::size_t Offset, std::size_t Count,
+	const Options& Opts
+)
+{
+	std::size_t Next = 0;
+
+	// Warmup, which also settles the clock frequency
+	const Clock::time_point WarmupEnd = Clock::now() + WarmupTime;
+	while( Clock::now() < WarmupEnd )
+	{
+		RunBatch(Func, Work, Next, Offset, Count, 1);
+	}
+
+	// Grow the batch until it is long enough to time accurately
+	const std::double_t MinBatch =
+		std::chrono::duration<std::double_t, std::nano>(MinBatchTime).count();
+	std::size_t Calls = 1;
+	while( RunBatch(Func, Work, Next, Offset, Count, Calls) < MinBatch )
+	{
+		Calls *= 2;
+	}
+
+	std::vector<std::double_t> Samples(std::max<std::size_t>(Opts.Samples, 1));
+	for( std::double_t& Sample : Samples )
+	{
+		Sample = RunBatch(Func, Work, Next, Offset, Count, Calls) / Calls;
+	}
+	std::sort(Samples.begin(), Samples.end());
+
+	Stats Time;
+	Time.Min = Samples.front();
+	Time.Median = Samples[Samples.size() / 2];
+	Time.P99 = Samples[
+		static_cast<std::size_t>(std::ceil(Samples.size() * 0.99)) - 1
+	];
+	return Time;
+}
+
+bool PinToCPU(int CPU)
+{
+#if defined(__linux__)
+	cpu_set_t Set;
+	CPU_ZERO(&Set);
+	CPU_SET(CPU, &Set);
+	return sched_setaffinity(0, sizeof(Set), &Set) == 0;
+#elif defined(_WIN32)
+	return SetThreadAffinityMask(
+		GetCurrentThread(), static_cast<DWORD_PTR>(1) << CPU
+	) != 0;
+#else
+	(void)CPU;
+	return false;
+#endif
+}
+
+const char* AlignmentName(qreverse::Alignment Align)
+{
+	switch( Align )
+	{
+	case qreverse::Alignment::Lower: return "Lower";
+	case qreverse::Alignment::Both:  return "Both";
+	default:                         return "None";
+	}
+}
+
+const char* TierName(qreverse::Tier Level)
+{
+	switch( Level )
+	{
+	case qreverse::Tier::Serial:     return "Serial";
+	case qreverse::Tier::Swap:       return "Swap";
+	case qreverse::Tier::SSSE3:      return "SSSE3";
+	case qreverse::Tier::NEON:       return "NEON";
+	case qreverse::Tier::AVX2:       return "AVX2";
+	case qreverse::Tier::AVX512:     return "AVX512";
+	case qreverse::Tier::AVX512VBMI: return "AVX512VBMI";
+	case qreverse::Tier::SVE:        return "SVE";
+	default:                         return "Unknown";
+	}
+}
+
+template< std::size_t ElementSize >
+void Bench(
+	const std::vector<std::pair<std::string, Kernel>>& Kernels,
+	std::size_t Count, const Options& Opts, std::vector<Result>& Results
+)
+{
+	Workspace Work(Count * ElementSize, Opts.Cold);
+
+	const std::size_t Offsets = Opts.Offsets ? 64 : 1;
+	for( std::size_t Offset = 0; Offset < Offsets; ++Offset )
+	{
+		const qreverse::Alignment Align = qreverse::GetAlignment<ElementSize>(
+			qreverse::HighestTier(), Work.Slot(0) + Offset, Count
+		);
+		std::double_t Baseline = 0.0;
+		for( const std::pair<std::string, Kernel>& Entry : Kernels )
+		{
+			Result Row;
+			Row.Kernel = Entry.first;
+			Row.Count = Count;
+			Row.Offset = Offset;
+			Row.Align = Align;
+			Row.Time = Measure(Entry.second, Work, Offset, Count, Opts);
+			if( Baseline == 0.0 )
+			{
+				Baseline = Row.Time.Median;
+			}
+			Row.Speedup = Baseline / Row.Time.Median;
+			Results.push_back(Row);
+		}
+	}
+}
+
+#if defined(__linux__)
+const char* PageBackingName(qreverse::PageBacking Backing)
+{
+	switch( Backing )
+	{
+	case qreverse::PageBacking::Transparent: return "THP";
+	case qreverse::PageBacking::Huge2M:      return "2MiB";
+	case qreverse::PageBacking::Huge1G:      return "1GiB";
+	default:                                 return "4KiB";
+	}
+}
+
+// Measures qReverse over arrays of base pages and then over arrays of the
+// largest pages available, each named after the pages it actually got
+template< std::size_t ElementSize >
+bool BenchPages(
+	std::size_t Count, const Options& Opts, std::vector<Result>& Results
+)
+{
+	std::double_t Baseline = 0.0;
+	for(
+		const qreverse::PageBacking Largest :
+		{qreverse::PageBacking::Small, qreverse::PageBacking::Huge1G}
+	)
+	{
+		Workspace Work(Count * ElementSize, Opts.Cold, Largest);
+		if( !Work.Slot(0) )
+		{
+			return false;
+		}
+		Result Row;
+		Row.Kernel = std::string("qReverse ") + PageBackingName(Work.Backing());
+		Row.Count = Count;
+		Row.Offset = 0;
+		Row.Align = qreverse::GetAlignment<ElementSize>(
+			qreverse::HighestTier(), Work.Slot(0), Count
+		);
+		Row.Time = Measure(qReverse<ElementSize>, Work, 0, Count, Opts);
+		if( Baseline == 0.0 )
+		{
+			Baseline = Row.Time.Median;
+		}
+		Row.Speedup = Baseline / Row.Time.Median;
+		Results.push_back(Row);
+	}
+	return true;
+}
+#endif
+
+template< std::size_t ElementSize >
+std::vector<std::pair<std::string, Kernel>> TierKernels()
+{
+	using qreverse::Tier;
+	const std::pair<Tier, Kernel> Forced[] = {
+		{Tier::Serial,     ForcedReverse<ElementSize, Tier::Serial>},
+		{Tier::Swap,       ForcedReverse<ElementSize, Tier::Swap>},
+		{Tier::SSSE3,      ForcedReverse<ElementSize, Tier::SSSE3>},
+		{Tier::NEON,       ForcedReverse<ElementSize, Tier::NEON>},
+		{Tier::AVX2,       ForcedReverse<ElementSize, Tier::AVX2>},
+		{Tier::AVX512,     ForcedReverse<ElementSize, Tier::AVX512>},
+		{Tier::AVX512VBMI, ForcedReverse<ElementSize, Tier::AVX512VBMI>},
+		{Tier::SVE,        ForcedReverse<ElementSize, Tier::SVE>},
+	};
+
+	std::vector<std::pair<std::string, Kernel>> Kernels;
+	for( const std::pair<Tier, Kernel>& Entry : Forced )
+	{
+		if( qreverse::GetReverseProc<ElementSize>(Entry.first) )
+		{
+			Kernels.emplace_back(TierName(Entry.first), Entry.second);
+		}
+	}
+	return Kernels;
+}
+
+// Compares each kernel against every kernel listed before it, walking down
+// from the largest element count until it is no longer the fastest of them
+std::vector<Crossover> Crossovers(
+	const std::vector<Result>& Results,
+	const std::vector<std::pair<std::string, Kernel>>& Kernels
+)
+{
+	// Median of each kernel at each count, with the counts in ascending order
+	std::vector<std::size_t> Counts;
+	for( const Result& Row : Results )
+	{
+		if( Row.Offset == 0 )
+		{
+			Counts.push_back(Row.Count);
+		}
+	}
+	std::sort(Counts.begin(), Counts.end());
+	Counts.erase(std::unique(Counts.begin(), Counts.end()), Counts.end());
+
+	std::vector<std::vector<std::double_t>> Medians(
+		Kernels.size(), std::vector<std::double_t>(Counts.size())
+	);
+	for( const Result& Row : Results )
+	{
+		if( Row.Offset != 0 )
+		{
+			continue;
+		}
+		const std::size_t CountIndex = std::lower_bound(
+			Counts.begin(), Counts.end(), Row.Count
+		) - Counts.begin();
+		for( std::size_t k = 0; k < Kernels.size(); ++k )
+		{
+			if( Kernels[k].first == Row.Kernel )
+			{
+				Medians[k][CountIndex] = Row.Time.Median;
+			}
+		}
+	}
+
+	std::vector<Crossover> Report;
+	for( std::size_t k = 1; k < Kernels.size(); ++k )
+	{
+		Crossover Entry;
+		Entry.Kernel = Kernels[k].first;
+		Entry.Count = 0;
+		for( std::size_t c = Counts.size(); c-- > 0; )
+		{
+			bool Fastest = true;
+			for( std::size_t Lower = 0; Lower < k; ++Lower )
+			{
+				Fastest &= Medians[k][c] < Medians[Lower][c];
+			}
+			if( !Fastest )
+			{
+				break;
+			}
+			Entry.Count = Counts[c];
+		}
+		Report.push_back(Entry);
+	}
+	return Report;
+}
+
+// Array bytes reversed per second, in gigabytes
+std::double_t Throughput(const Result& Row, std::size_t ElementSize)
+{
+	return (Row.Count * ElementSize) / Row.Time.Median;
+}
+
+void PrintMarkdown(
+	const std::vector<Result>& Results, std::size_t ElementSize,
+	const std::vector<Crossover>& Report
+)
+{
+	std::cout << std::fixed << std::setprecision(3);
+
+	std::cout
+		<< "Element Count" << '|'
+		<< "Offset" << '|'
+		<< "Alignment" << '|'
+		<< "Kernel" << '|'
+		<< "Min" << '|'
+		<< "Median" << '|'
+		<< "P99" << '|'
+		<< "Per Element" << '|'
+		<< "Throughput" << '|'
+		<< "Speedup Factor"
+		<< std::endl;
+
+	std::cout
+		<< "---|" // Element count
+		<< "---|" // Offset
+		<< "---|" // Alignment
+		<< "---|" // Kernel
+		<< "---|" // Min
+		<< "---|" // Median
+		<< "---|" // P99
+		<< "---|" // Per element
+		<< "---|" // Throughput
+		<< "---" // Speedup
+		<< std::endl;
+
+	for( const Result& Row : Results )
+	{
+		std::cout
+			<< Row.Count << '|'
+			<< Row.Offset << '|'
+			<< AlignmentName(Row.Align) << '|'
+			<< Row.Kernel << '|'
+			<< Row.Time.Min << " ns|"
+			<< Row.Time.Median << " ns|"
+			<< Row.Time.P99 << " ns|"
+			<< Row.Time.Median / Row.Count << " ns|"
+			<< Throughput(Row, ElementSize) << " GB/s|"
+			<< (Row.Speedup > 1.0 ? "**" : "*")
+			<< Row.Speedup
+			<< (Row.Speedup > 1.0 ? "**" : "*")
+			<< std::endl;
+	}
+
+	if( Report.empty() )
+	{
+		return;
+	}
+
+	std::cout
+		<< std::endl
+		<< "Tier" << '|'
+		<< "Fastest From Element Count"
+		<< std::endl;
+
+	std::cout
+		<< "---|" // Tier
+		<< "---" // Crossover
+		<< std::endl;
+
+	for( const Crossover& Entry : Report )
+	{
+		std::cout << Entry.Kernel << '|';
+		if( Entry.Count )
+		{
+			std::cout << Entry.Count;
+		}
+		else
+		{
+			std::cout << "Never";
+		}
+		std::cout << std::endl;
+	}
+}
+
+void PrintCSV(const std::vector<Result>& Results, std::size_t ElementSize)
+{
+	std::cout << std::fixed << std::setprecision(3);
+
+	std::cout
+		<< "element_size,count,offset,alignment,kernel,"
+		<< "min_ns,median_ns,p99_ns,ns_per_element,gb_per_second,speedup"
+		<< std::endl;
+
+	for( const Result& Row : Results )
+	{
+		std::cout
+			<< ElementSize << ','
+			<< Row.Count << ','
+			<< Row.Offset << ','
+			<< AlignmentName(Row.Align) << ','
+			<< Row.Kernel << ','
+			<< Row.Time.Min << ','
+			<< Row.Time.Median << ','
+			<< Row.Time.P99 << ','
+			<< Row.Time.Median / Row.Count << ','
+			<< Throughput(Row, ElementSize) << ','
+			<< Row.Speedup
+			<< std::endl;
+	}
+}
+
+void PrintJSON(
+	const std::vector<Result>& Results, std::size_t ElementSize,
+	const std::vector<Crossover>& Report, const Options& Opts
+)
+{
+	std::cout << std::fixed << std::setprecision(3);
+
+	std::cout
+		<< "{\n"
+		<< "  \"context\": {\n"
+		<< "    \"element_size\": " << ElementSize << ",\n"
+		<< "    \"tier\": \"" << TierName(qreverse::HighestTier()) << "\",\n"
+		<< "    \"cache\": \"" << (Opts.Cold ? "cold" : "hot") << "\",\n"
+		<< "    \"pinned_cpu\": " << Opts.Pin << ",\n"
+		<< "    \"samples\": " << Opts.Samples << "\n"
+		<< "  },\n"
+		<< "  \"benchmarks\": [";
+
+	for( std::size_t i = 0; i < Results.size(); ++i )
+	{
+		const Result& Row = Results[i];
+		std::cout
+			<< (i ? "," : "") << "\n    {"
+			<< "\"kernel\": \"" << Row.Kernel << "\", "
+			<< "\"count\": " << Row.Count << ", "
+			<< "\"offset\": " << Row.Offset << ", "
+			<< "\"alignment\": \"" << AlignmentName(Row.Align) << "\", "
+			<< "\"min_ns\": " << Row.Time.Min << ", "
+			<< "\"median_ns\": " << Row.Time.Median << ", "
+			<< "\"p99_ns\": " << Row.Time.P99 << ", "
+			<< "\"ns_per_element\": " << Row.Time.Median / Row.Count << ", "
+			<< "\"gb_per_second\": " << Throughput(Row, ElementSize) << ", "
+			<< "\"speedup\": " << Row.Speedup
+			<< "}";
+	}
+
+	std::cout << "\n  ],\n  \"crossovers\": [";
+
+	for( std::size_t i = 0; i < Report.size(); ++i )
+	{
+		std::cout
+			<< (i ? "," : "") << "\n    {"
+			<< "\"kernel\": \"" << Report[i].Kernel << "\", "
+			<< "\"count\": ";
+		if( Report[i].Count )
+		{
+			std::cout << Report[i].Count;
+		}
+		else
+		{
+			std::cout << "null";
+		}
+		std::cout << "}";
+	}
+
+	std::cout << "\n  ]\n}" << std::endl;
+}
+
+bool ParseOptions(int argc, char* argv[], Options& Opts)
+{
+	for( int i = 1; i < argc; ++i )
+	{
+		const std::string Arg(argv[i]);
+		if( Arg == "offsets" )
+		{
+			Opts.Offsets = true;
+		}
+		else if( Arg == "tiers" )
+		{
+			Opts.Tiers = true;
+		}
+		else if( Arg == "pages" )
+		{
+#if defined(__linux__)
+			Opts.Pages = true;
+#else
+			std::cerr << "Huge pages are only measured on Linux" << std::endl;
+			return false;
+#endif
+		}
+		else if( Arg == "--format=markdown" )
+		{
+			Opts.Output = Format::Markdown;
+		}
+		else if( Arg == "--format=json" )
+		{
+			Opts.Output = Format::JSON;
+		}
+		else if( Arg == "--format=csv" )
+		{
+			Opts.Output = Format::CSV;
+		}
+		else if( Arg == "--cache=hot" )
+		{
+			Opts.Cold = false;
+		}
+		else if( Arg == "--cache=cold" )
+		{
+			Opts.Cold = true;
+		}
+		else if( Arg.compare(0, 6, "--pin=") == 0 )
+		{
+			Opts.Pin = std::atoi(Arg.c_str() + 6);
+		}
+		else if( Arg.compare(0, 10, "--samples=") == 0 )
+		{
+			Opts.Samples = std::strtoull(Arg.c_str() + 10, nullptr, 10);
+		}
+		else
+		{
+			const std::size_t Count = std::strtoull(Arg.c_str(), nullptr, 10);
+			if( Count == 0 )
+			{
+				std::cerr << "Unknown argument: " << Arg << std::endl;
+				return false;
+			}
+			Opts.Counts.push_back(Count);
+		}
+	}
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	Options Opts;
+	if( !ParseOptions(argc, argv, Opts) )
+	{
+		std::cerr
+			<< "Usage: Benchmark# [offsets] [tiers] [pages] [--format=markdown|json|csv] "
+			<< "[--cache=hot|cold] [--pin=CPU] [--samples=N] [Element Count...]"
+			<< std::endl;
+		return EXIT_FAILURE;
+	}
+
+	if( Opts.Pin >= 0 && !PinToCPU(Opts.Pin) )
+	{
+		std::cerr << "Unable to pin to CPU " << Opts.Pin << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	if( Opts.Counts.empty() && Opts.Offsets )
+	{
+		Opts.Counts = {10000};
+	}
+	else if( Opts.Counts.empty() && Opts.Tiers )
+	{
+		Opts.Counts = {2, 5, 10, 17, 32, 100, 1000, 10000, 100000, 1000000};
+	}
+	else if( Opts.Counts.empty() && Opts.Pages )
+	{
+		for( const std::size_t Size : {4u << 20, 64u << 20, 256u << 20} )
+		{
+			Opts.Counts.push_back(Size / ELEMENTSIZE);
+		}
+	}
+	else if( Opts.Counts.empty() )
+	{
+		Opts.Counts = {
+			// Powers of two
+			8, 16, 32, 64, 128, 256, 512, 1024,
+			// Powers of ten
+			100, 1000, 10000, 100000, 1000000,
+			// Primes
+			59, 79, 173, 6133, 10177, 25253, 31391, 50432,
+		};
+	}
+
+	// Against std::reverse, or each tier against the ones below it
+	const std::vector<std::pair<std::string, Kernel>> Kernels = Opts.Tiers
+		? TierKernels<ELEMENTSIZE>()
+		: std::vector<std::pair<std::string, Kernel>>{
+			{"std::reverse", StdReverse<ELEMENTSIZE>},
+			{"qReverse",     qReverse<ELEMENTSIZE>},
+		};
+
+	/// Benchmark
+	std::vector<Result> Results;
+	for( const std::size_t Count : Opts.Counts )
+	{
+#if defined(__linux__)
+		if( Opts.Pages )
+		{
+			if( !BenchPages<ELEMENTSIZE>(Count, Opts, Results) )
+			{
+				std::cerr << "Unable to map " << Count << " elements" << std::endl;
+				return EXIT_FAILURE;
+			}
+			continue;
+		}
+#endif
+		Bench<ELEMENTSIZE>(Kernels, Count, Opts, Results);
+	}
+
+	const std::vector<Crossover> Report = Opts.Tiers
+		? Crossovers(Results, Kernels) : std::vector<Crossover>();
+
+	switch( Opts.Output )
+	{
+	case Format::Markdown: PrintMarkdown(Results, ELEMENTSIZE, Report); break;
+	case Format::JSON:     PrintJSON(Results, ELEMENTSIZE, Report, Opts); break;
+	case Format::CSV:      PrintCSV(Results, ELEMENTSIZE); break;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,547 @@
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <qreverse.hpp>
+#include <qreverse/batch.hpp>
+#include <qreverse/fixed.hpp>
+#include <qreverse/planar.hpp>
+
+/*
+For use with cmake:
+	Checks the kernels of every tier that the machine supports, each forced
+	on its own, against std::reverse and friends at the designated
+	compile-time element size. Covers reversal, reverse-copy, byteswapping,
+	batched and fixed-count reversal, and reversing deinterleave, as well as
+	qReverseRange and qRotate through the selected tier.
+
+	Define ELEMENTSIZE preprocessor value to adjust verified element size
+
+	Define QREVERSE_PREFETCH_THRESHOLD and QREVERSE_STREAM_THRESHOLD to a few
+	hundred bytes to have the prefetching and streaming variants, which are
+	otherwise only taken by arrays of many megabytes, run over the same cases.
+
+	Usage: Differential# [Iterations] [Seed]
+
+	Every element count up to a few of the widest registers is first checked
+	at every base offset within a cache line. Then Iterations random cases,
+	2000 by default, draw their element count, offsets, and the split of the
+	reversal into two ranges, as the parallel reversal calls the kernels. The
+	seed is printed on failure along with the case, so that it can be run
+	again.
+
+	Define QREVERSE_FUZZ to instead build a libFuzzer entry point, which takes
+	the offsets and split from the first bytes of its input and reverses the
+	rest.
+*/
+
+#ifndef ELEMENTSIZE
+#define ELEMENTSIZE 1
+#endif
+
+namespace
+{
+
+// Bytes around each array that no kernel may write to
+const std::size_t GuardSize = 64;
+const std::uint8_t GuardByte = 0xA5;
+
+// Element counts up to this many bytes are checked exhaustively, which covers
+// the tails and overlapping steps of the widest kernels a few times over
+const std::size_t SweepSize = 1024;
+
+// Largest random array, in bytes
+const std::size_t RandomSize = 256 * 1024;
+
+struct Case
+{
+	qreverse::Tier Level;
+	std::size_t Count;
+	// Misalignment of the array, and of the destination of a reverse-copy
+	std::size_t Offset;
+	std::size_t DstOffset;
+	// Pairs exchanged by the first of the two calls that make up a reversal,
+	// which also picks the batch, planes, and rotation of the case
+	std::size_t Split;
+};
+
+struct ElementType
+{
+	std::uint8_t u8[ELEMENTSIZE];
+};
+
+static_assert(
+	sizeof(ElementType) == ELEMENTSIZE,
+	"ElementSize is pad-aligned and does not match specified element size"
+);
+
+const char* TierName(qreverse::Tier Level)
+{
+	switch( Level )
+	{
+	case qreverse::Tier::Serial:     return "Serial";
+	case qreverse::Tier::Swap:       return "Swap";
+	case qreverse::Tier::SSSE3:      return "SSSE3";
+	case qreverse::Tier::NEON:       return "NEON";
+	case qreverse::Tier::AVX2:       return "AVX2";
+	case qreverse::Tier::AVX512:     return "AVX512";
+	case qreverse::Tier::AVX512VBMI: return "AVX512VBMI";
+	case qreverse::Tier::SVE:        return "SVE";
+	default:                         return "Unknown";
+	}
+}
+
+std::vector<qreverse::Tier> SupportedTiers()
+{
+	std::vector<qreverse::Tier> Tiers;
+	for(
+		std::size_t Level = 0;
+		Level < static_cast<std::size_t>(qreverse::Tier::Count); ++Level
+	)
+	{
+		if( qreverse::GetReverseProc<ELEMENTSIZE>(qreverse::Tier(Level)) )
+		{
+			Tiers.push_back(qreverse::Tier(Level));
+		}
+	}
+	return Tiers;
+}
+
+// An array at an offset within a cache line, surrounded by guard bytes
+class Guarded
+{
+public:
+	Guarded(const std::uint8_t* Source, std::size_t Bytes, std::size_t Offset)
+		: Buffer(GuardSize + Offset, GuardByte), Bytes(Bytes), Offset(Offset)
+	{
+		if( Source )
+		{
+			Buffer.insert(Buffer.end(), Source, Source + Bytes);
+		}
+		Buffer.resize(GuardSize * 2 + 64 + Bytes, GuardByte);
+	}
+
+	std::uint8_t* Data()
+	{
+		return &Buffer[GuardSize + Offset];
+	}
+
+	// Whether the array holds Expected and nothing around it was written
+	bool Holds(const std::uint8_t* Expected) const
+	{
+		const auto Guard = [](std::uint8_t Byte){ return Byte == GuardByte; };
+		const std::uint8_t* Array = &Buffer[GuardSize + Offset];
+		return std::equal(Array, Array + Bytes, Expected)
+			&& std::all_of(Buffer.data(), Array, Guard)
+			&& std::all_of(Array + Bytes, Buffer.data() + Buffer.size(), Guard);
+	}
+
+private:
+	std::vector<std::uint8_t> Buffer;
+	std::size_t Bytes;
+	std::size_t Offset;
+};
+
+std::vector<std::uint8_t> Reversed(const std::uint8_t* Source, std::size_t Count)
+{
+	std::vector<std::uint8_t> Expected(Source, Source + Count * ELEMENTSIZE);
+	ElementType* ExpectedN = reinterpret_cast<ElementType*>(Expected.data());
+	std::reverse(ExpectedN, ExpectedN + Count);
+	return Expected;
+}
+
+// In-place, split in two calls at a pair boundary
+bool CheckReverse(const Case& Test, const std::uint8_t* Source)
+{
+	const std::vector<std::uint8_t> Expected = Reversed(Source, Test.Count);
+	Guarded Array(Source, Test.Count * ELEMENTSIZE, Test.Offset);
+	const qreverse::ReverseProc Reverse =
+		qreverse::GetReverseProc<ELEMENTSIZE>(Test.Level);
+	const std::size_t Split = std::min(Test.Split, Test.Count / 2);
+	Reverse(Array.Data(), Test.Count, 0, Split);
+	Reverse(Array.Data(), Test.Count, Split, Test.Count / 2);
+	return Array.Holds(Expected.data());
+}
+
+// Out-of-place, with the source and destination misaligned apart
+bool CheckReverseCopy(const Case& Test, const std::uint8_t* Source)
+{
+	const std::size_t Bytes = Test.Count * ELEMENTSIZE;
+	const std::vector<std::uint8_t> Expected = Reversed(Source, Test.Count);
+	Guarded Src(Source, Bytes, Test.Offset);
+	Guarded Dst(nullptr, Bytes, Test.DstOffset);
+	qreverse::GetReverseCopyProc<ELEMENTSIZE>(Test.Level)(
+		Src.Data(), Dst.Data(), Test.Count
+	);
+	return Dst.Holds(Expected.data()) && Src.Holds(Source);
+}
+
+bool CheckByteswap(const Case& Test, const std::uint8_t* Source)
+{
+	const std::size_t Bytes = Test.Count * ELEMENTSIZE;
+	std::vector<std::uint8_t> Expected(Source, Source + Bytes);
+	for( std::size_t i = 0; i < Test.Count; ++i )
+	{
+		std::reverse(
+			&Expected[i * ELEMENTSIZE], &Expected[i * ELEMENTSIZE] + ELEMENTSIZE
+		);
+	}
+	Guarded Array(Source, Bytes, Test.Offset);
+	qreverse::GetByteswapProc<ELEMENTSIZE>(Test.Level)(Array.Data(), Test.Count);
+	return Array.Holds(Expected.data());
+}
+
+// A batch of up to four arrays of the case's count and smaller ones, each at
+// an offset of its own
+bool CheckBatch(const Case& Test, const std::uint8_t* Source)
+{
+	const std::size_t Batch = Test.Split % 4 + 1;
+	std::vector<Guarded> Arrays;
+	std::vector<void*> Pointers;
+	std::vector<std::size_t> Counts;
+	for( std::size_t k = 0; k < Batch; ++k )
+	{
+		Counts.push_back(Test.Count / (k + 1));
+		Arrays.emplace_back(
+			Source, Counts[k] * ELEMENTSIZE, (Test.Offset + k * 13) % 64
+		);
+	}
+	for( Guarded& Array : Arrays )
+	{
+		Pointers.push_back(Array.Data());
+	}
+	qreverse::GetReverseBatchProc<ELEMENTSIZE>(Test.Level)(
+		Pointers.data(), Counts.data(), Batch
+	);
+	for( std::size_t k = 0; k < Batch; ++k )
+	{
+		if( !Arrays[k].Holds(Reversed(Source, Counts[k]).data()) )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Frames of two to five planes out of the case's elements, with element i of
+// plane k being element k of frame Frames - i - 1
+bool CheckDeinterleave(const Case& Test, const std::uint8_t* Source)
+{
+	const std::size_t PlaneCount = Test.Split % 4 + 2;
+	const std::size_t Frames = Test.Count / PlaneCount;
+	const std::size_t FrameSize = PlaneCount * ELEMENTSIZE;
+	Guarded Src(Source, Frames * FrameSize, Test.Offset);
+	std::vector<Guarded> Planes;
+	std::vector<void*> Pointers;
+	for( std::size_t k = 0; k < PlaneCount; ++k )
+	{
+		Planes.emplace_back(
+			nullptr, Frames * ELEMENTSIZE, (Test.DstOffset + k * 7) % 64
+		);
+	}
+	for( Guarded& Plane : Planes )
+	{
+		Pointers.push_back(Plane.Data());
+	}
+	const qreverse::ReverseDeinterleaveProc Deinterleave =
+		qreverse::GetReverseDeinterleaveProc<ELEMENTSIZE>(Test.Level);
+	if( !Deinterleave )
+	{
+		return true;
+	}
+	Deinterleave(Src.Data(), Pointers.data(), PlaneCount, Frames);
+	std::vector<std::uint8_t> Expected(Frames * ELEMENTSIZE);
+	for( std::size_t k = 0; k < PlaneCount; ++k )
+	{
+		for( std::size_t i = 0; i < Frames; ++i )
+		{
+			std::memcpy(
+				&Expected[i * ELEMENTSIZE],
+				&Source[(Frames - i - 1) * FrameSize + k * ELEMENTSIZE],
+				ELEMENTSIZE
+			);
+		}
+		if( !Planes[k].Holds(Expected.data()) )
+		{
+			return false;
+		}
+	}
+	return Src.Holds(Source);
+}
+
+// Runs one case of a tier over Source, returning which entry point disagreed
+// with its reference or wrote outside of its arrays
+const char* Check(const Case& Test, const std::uint8_t* Source)
+{
+	if( !CheckReverse(Test, Source) )
+	{
+		return "reversal";
+	}
+	if( !CheckReverseCopy(Test, Source) )
+	{
+		return "reverse-copy";
+	}
+	if( !CheckByteswap(Test, Source) )
+	{
+		return "byteswap";
+	}
+	if( !CheckBatch(Test, Source) )
+	{
+		return "batch";
+	}
+	if( !CheckDeinterleave(Test, Source) )
+	{
+		return "deinterleave";
+	}
+	return nullptr;
+}
+
+// qReverseRange and qRotate only ever go through the selected tier, so they
+// are checked once per case rather than once per tier
+const char* CheckSelected(const Case& Test, const std::uint8_t* Source)
+{
+	const std::size_t Bytes = Test.Count * ELEMENTSIZE;
+	const std::size_t First = Test.Count ? Test.Split % Test.Count : 0;
+	const std::size_t Last = Test.Count - First / 2;
+
+	std::vector<std::uint8_t> Expected(Source, Source + Bytes);
+	ElementType* ExpectedN = reinterpret_cast<ElementType*>(Expected.data());
+	std::reverse(ExpectedN + First, ExpectedN + Last);
+	Guarded Range(Source, Bytes, Test.Offset);
+	qReverseRange<ELEMENTSIZE>(Range.Data(), First, Last);
+	if( !Range.Holds(Expected.data()) )
+	{
+		return "range";
+	}
+
+	Expected.assign(Source, Source + Bytes);
+	std::rotate(ExpectedN, ExpectedN + First, ExpectedN + Test.Count);
+	Guarded Rotated(Source, Bytes, Test.Offset);
+	qRotate<ELEMENTSIZE>(Rotated.Data(), Test.Count, First);
+	if( !Rotated.Holds(Expected.data()) )
+	{
+		return "rotation";
+	}
+	return nullptr;
+}
+
+void Report(const char* Failed, const Case& Test, std::uint64_t Seed)
+{
+	std::cout
+		<< "[FAIL] " << TierName(Test.Level) << ' ' << Failed
+		<< " of " << Test.Count << " elements"
+		<< " at offset " << Test.Offset
+		<< " to offset " << Test.DstOffset
+		<< " split after " << Test.Split << " pairs"
+		<< " (seed " << Seed << ')'
+		<< std::endl;
+}
+
+// Runs a case under every tier, and through the selected one
+bool CheckTiers(
+	Case Test, const std::vector<qreverse::Tier>& Tiers,
+	const std::uint8_t* Source, std::uint64_t Seed
+)
+{
+	for( const qreverse::Tier Level : Tiers )
+	{
+		Test.Level = Level;
+		if( const char* Failed = Check(Test, Source) )
+		{
+			Report(Failed, Test, Seed);
+			return false;
+		}
+	}
+	Test.Level = qreverse::HighestTier();
+	if( const char* Failed = CheckSelected(Test, Source) )
+	{
+		Report(Failed, Test, Seed);
+		return false;
+	}
+	return true;
+}
+
+// Fixed-count kernels of every tier at every offset, for counts about the
+// width of each register clamped to the 4KiB that qReverseFixed takes at most.
+// Element sizes without fixed-count steps only go through qReverseFixed, which
+// hands them to qReverse.
+template< std::size_t... Counts >
+struct FixedCounts
+{
+};
+
+template< std::size_t Count >
+bool CheckFixedTiers(
+	const std::vector<qreverse::Tier>& Tiers, const std::uint8_t* Source,
+	const std::uint8_t* Expected, std::true_type
+)
+{
+	for( const qreverse::Tier Level : Tiers )
+	{
+		const qreverse::ReverseFixedProc Reverse =
+			qreverse::GetReverseFixedProc<ELEMENTSIZE, Count>(Level);
+		for( std::size_t Offset = 0; Reverse && Offset < 64; ++Offset )
+		{
+			Guarded Array(Source, Count * ELEMENTSIZE, Offset);
+			Reverse(Array.Data());
+			if( !Array.Holds(Expected) )
+			{
+				const Case Test = {Level, Count, Offset, 0, Count};
+				Report("fixed-count reversal", Test, 0);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+template< std::size_t Count >
+bool CheckFixedTiers(
+	const std::vector<qreverse::Tier>&, const std::uint8_t*,
+	const std::uint8_t*, std::false_type
+)
+{
+	return true;
+}
+
+bool CheckFixed(
+	FixedCounts<>, const std::vector<qreverse::Tier>&, const std::uint8_t*
+)
+{
+	return true;
+}
+
+template< std::size_t Requested, std::size_t... Rest >
+bool CheckFixed(
+	FixedCounts<Requested, Rest...>, const std::vector<qreverse::Tier>& Tiers,
+	const std::uint8_t* Source
+)
+{
+	constexpr std::size_t Count = Requested * ELEMENTSIZE <= 4096
+		? Requested : 4096 / ELEMENTSIZE;
+	const std::vector<std::uint8_t> Expected = Reversed(Source, Count);
+	for( std::size_t Offset = 0; Offset < 64; ++Offset )
+	{
+		Guarded Array(Source, Count * ELEMENTSIZE, Offset);
+		qReverseFixed<ELEMENTSIZE, Count>(Array.Data());
+		if( !Array.Holds(Expected.data()) )
+		{
+			const Case Test = {qreverse::HighestTier(), Count, Offset, 0, Count};
+			Report("fixed-count reversal", Test, 0);
+			return false;
+		}
+	}
+	return CheckFixedTiers<Count>(
+		Tiers, Source, Expected.data(),
+		qreverse::detail::HasFixedSteps<ELEMENTSIZE>()
+	) && CheckFixed(FixedCounts<Rest...>(), Tiers, Source);
+}
+
+} // namespace
+
+#if defined(QREVERSE_FUZZ)
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* Data, std::size_t Size)
+{
+	static const std::vector<qreverse::Tier> Tiers = SupportedTiers();
+	if( Size < 4 )
+	{
+		return 0;
+	}
+	Case Test;
+	Test.Offset = Data[0] % 64;
+	Test.DstOffset = Data[1] % 64;
+	Test.Split = static_cast<std::size_t>(Data[2]) | (Data[3] << 8);
+	Test.Count = (Size - 4) / ELEMENTSIZE;
+	if( !CheckTiers(Test, Tiers, Data + 4, 0) )
+	{
+		std::abort();
+	}
+	return 0;
+}
+
+#else
+
+int main(int argc, char* argv[])
+{
+	const std::size_t Iterations = argc > 1
+		? std::strtoull(argv[1], nullptr, 10) : 2000;
+	const std::uint64_t Seed = argc > 2
+		? std::strtoull(argv[2], nullptr, 10) : 0x7265766572736551ull;
+
+	const std::vector<qreverse::Tier> Tiers = SupportedTiers();
+	std::mt19937_64 Random(Seed);
+
+	std::vector<std::uint8_t> Source(std::max(SweepSize, RandomSize));
+	for( std::uint8_t& Byte : Source )
+	{
+		Byte = static_cast<std::uint8_t>(Random());
+	}
+
+	if(
+		!CheckFixed(
+			FixedCounts<
+				1, 2, 3, 5, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 128, 129,
+				255, 256, 257
+			>(),
+			Tiers, Source.data()
+		)
+	)
+	{
+		return EXIT_FAILURE;
+	}
+
+	// Every count and offset about the widest registers, in a single call
+	const std::size_t SweepCount = SweepSize / ELEMENTSIZE;
+	for( std::size_t Count = 0; Count <= SweepCount; ++Count )
+	{
+		for( std::size_t Offset = 0; Offset < 64; ++Offset )
+		{
+			const Case Test = {
+				qreverse::Tier::Serial, Count, Offset, 63 - Offset, Count
+			};
+			if( !CheckTiers(Test, Tiers, Source.data(), Seed) )
+			{
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+	// Random counts spread evenly over each power of two, so that large
+	// arrays are as likely to come up as small ones
+	const std::size_t MaxCount = RandomSize / ELEMENTSIZE;
+	std::size_t MaxBits = 0;
+	while( (std::size_t(1) << MaxBits) < MaxCount )
+	{
+		++MaxBits;
+	}
+	for( std::size_t Iteration = 0; Iteration < Iterations; ++Iteration )
+	{
+		const std::size_t Bits = Random() % (MaxBits + 1);
+		Case Test;
+		Test.Level = qreverse::Tier::Serial;
+		Test.Count = std::min<std::size_t>(
+			Random() % ((std::size_t(1) << Bits) + 1), MaxCount
+		);
+		Test.Offset = Random() % 64;
+		Test.DstOffset = Random() % 64;
+		Test.Split = static_cast<std::size_t>(Random() % (Test.Count / 2 + 1));
+		if( !CheckTiers(Test, Tiers, Source.data(), Seed) )
+		{
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::cout
+		<< "Checked " << Tiers.size() << " tiers over "
+		<< (SweepCount + 1) * 64 + Iterations << " cases" << std::endl;
+	return EXIT_SUCCESS;
+}
+
+#endif
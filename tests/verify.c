@@ -0,0 +1,104 @@
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <qreverse.h>
+
+/*
+For use with cmake:
+	Verifies the C interface of the qreverse library against an element-wise
+	reversal, at every element size up to 130 bytes.
+
+	Usage: VerifyC (Element Count)
+*/
+
+static void ReverseReference(
+	const uint8_t* Src, uint8_t* Dst, size_t Count, size_t ElementSize
+)
+{
+	size_t i;
+	for( i = 0; i < Count; ++i )
+	{
+		memcpy(
+			&Dst[i * ElementSize], &Src[(Count - i - 1) * ElementSize],
+			ElementSize
+		);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	size_t ElementCount;
+	size_t ElementSize;
+	size_t i;
+	uint8_t* Array;
+	uint8_t* Expected;
+	int Failed = 0;
+
+	if( argc < 2 )
+	{
+		printf("Usage: VerifyC (Element Count)\n");
+		return EXIT_FAILURE;
+	}
+	ElementCount = strtoul(argv[1], NULL, 10);
+	if( ElementCount == 0 )
+	{
+		return EXIT_FAILURE;
+	}
+
+	Array = (uint8_t*)malloc(ElementCount * 130);
+	Expected = (uint8_t*)malloc(ElementCount * 130);
+	if( !Array || !Expected )
+	{
+		return EXIT_FAILURE;
+	}
+
+	for( ElementSize = 1; ElementSize <= 130 && !Failed; ++ElementSize )
+	{
+		for( i = 0; i < ElementCount * ElementSize; ++i )
+		{
+			Array[i] = (uint8_t)(i * 7 + ElementSize);
+		}
+		ReverseReference(Array, Expected, ElementCount, ElementSize);
+		qreverse_n(Array, ElementCount, ElementSize);
+		if( memcmp(Array, Expected, ElementCount * ElementSize) )
+		{
+			printf("[FAIL] qreverse_n(%zu) Array Not Reversed\n", ElementSize);
+			Failed = 1;
+		}
+
+		// The fixed-size entry points must agree with the generic one
+		if( ElementSize == 1 || ElementSize == 2 || ElementSize == 4
+			|| ElementSize == 8 || ElementSize == 16 )
+		{
+			for( i = 0; i < ElementCount * ElementSize; ++i )
+			{
+				Array[i] = (uint8_t)(i * 7 + ElementSize);
+			}
+			switch( ElementSize )
+			{
+			case 1: qreverse_u8(Array, ElementCount); break;
+			case 2: qreverse_u16(Array, ElementCount); break;
+			case 4: qreverse_u32(Array, ElementCount); break;
+			case 8: qreverse_u64(Array, ElementCount); break;
+			case 16: qreverse_u128(Array, ElementCount); break;
+			}
+			if( memcmp(Array, Expected, ElementCount * ElementSize) )
+			{
+				printf("[FAIL] qreverse_u%zu Array Not Reversed\n", ElementSize * 8);
+				Failed = 1;
+			}
+		}
+	}
+
+	free(Array);
+	free(Expected);
+	if( Failed )
+	{
+		return EXIT_FAILURE;
+	}
+	printf("[PASS] Array Reversed\n");
+	return EXIT_SUCCESS;
+}
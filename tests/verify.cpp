@@ -1,90 +1,760 @@
-#include <cstdint>
-#include <cstddef>
-#include <climits>
-#include <iostream>
-#include <string>
-#include <vector>
-
-#include <qreverse.hpp>
-
-/*
-For use with cmake:
-	Verifies that qreverse can properly reverse an array at the designated
-	compile-time element size.
-
-	Define ELEMENTSIZE preprocessor value to adjust verified element size
-*/
-
-#ifndef ELEMENTSIZE
-#define ELEMENTSIZE 1
-#endif
-
-int main(int argc, char* argv[])
-{
-	if( argc < 2 )
-	{
-		std::cout << "Usage: Verify# (Element Count)"
-			<< std::endl;
-		return EXIT_FAILURE;
-	}
-
-	std::size_t ElementCount;
-
-	ElementCount = std::strtoull(argv[1], nullptr, 10);
-
-	if( ElementCount == 0 || ElementCount == ULLONG_MAX )
-	{
-		return EXIT_FAILURE;
-	}
-
-	std::vector<std::uint8_t> Array(ELEMENTSIZE * ElementCount);
-
-	std::cout << "Original: " << std::endl;
-	for( std::size_t i = 0; i < ElementCount; ++i )
-	{
-		std::uint8_t* Element = &Array[i * ELEMENTSIZE];
-		for( std::size_t j = 0; j < ELEMENTSIZE; ++j )
-		{
-			Element[j] = static_cast<std::uint8_t>(i);
-			std::cout << +Element[j] << ' ';
-		}
-	}
-
-	std::cout << std::endl;
-
-	std::vector<std::uint8_t> Reversed(Array);
-
-	qReverse<ELEMENTSIZE>(Reversed.data(), ElementCount);
-
-	std::cout << "Reversed: " << std::endl;
-	for( std::size_t i = 0; i < ElementCount; ++i )
-	{
-		std::uint8_t* Element = &Reversed[i * ELEMENTSIZE];
-		for( std::size_t j = 0; j < ELEMENTSIZE; ++j )
-		{
-			std::cout << +Element[j] << ' ';
-		}
-	}
-
-	std::cout << std::endl;
-
-	// Verify proper reversal
-	for( std::size_t i = 0; i < ElementCount; ++i )
-	{
-		const std::uint8_t* OriginalElem = &Array[(ElementCount - i - 1) * ELEMENTSIZE];
-		const std::uint8_t* ReversedElem = &Reversed[i * ELEMENTSIZE];
-		for( std::size_t j = 0; j < ELEMENTSIZE; ++j )
-		{
-			if( OriginalElem[j] != ReversedElem[j] )
-			{
-				// Mismatch, not reversed
-				std::cout << "[FAIL] Array Not Reversed" << std::endl;
-				return EXIT_FAILURE;
-			}
-		}
-	}
-
-	// Successfully reversed
-	std::cout << "[PASS] Array Reversed" << std::endl;
-	return EXIT_SUCCESS;
+#include <cstdint>
+#include <cstddef>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <qreverse.hpp>
+#include <qreverse/adaptive.hpp>
+#include <qreverse/algorithm.hpp>
+#include <qreverse/async.hpp>
+#include <qreverse/batch.hpp>
+#include <qreverse/fixed.hpp>
+#include <qreverse/parallel.hpp>
+#include <qreverse/planar.hpp>
+#include <qreverse/reverse2d.hpp>
+#include <qreverse/view.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <qreverse/file.hpp>
+#endif
+#if defined(__linux__)
+#include <qreverse/hugepage.hpp>
+#include <qreverse/numa.hpp>
+#endif
+
+/*
+For use with cmake:
+	Verifies that qreverse can properly reverse an array at the designated
+	compile-time element size.
+
+	Define ELEMENTSIZE preprocessor value to adjust verified element size
+*/
+
+#ifndef ELEMENTSIZE
+#define ELEMENTSIZE 1
+#endif
+
+// Checks qReverseFixed, and the fixed kernel of every tier the machine
+// supports, against std::reverse at a compile-time element count, clamped to
+// the 4KiB that qReverseFixed takes at most
+template< std::size_t Requested >
+bool VerifyFixed()
+{
+	struct ElementType
+	{
+		std::uint8_t u8[ELEMENTSIZE];
+	};
+	constexpr std::size_t Count = Requested * ELEMENTSIZE <= 4096
+		? Requested : 4096 / ELEMENTSIZE;
+	std::vector<std::uint8_t> Original(Count * ELEMENTSIZE);
+	for( std::size_t i = 0; i < Original.size(); ++i )
+	{
+		Original[i] = static_cast<std::uint8_t>(i * 7);
+	}
+	std::vector<std::uint8_t> Expected(Original);
+	ElementType* ExpectedN = reinterpret_cast<ElementType*>(Expected.data());
+	std::reverse(ExpectedN, ExpectedN + Count);
+
+	std::vector<std::uint8_t> Fixed(Original);
+	qReverseFixed<ELEMENTSIZE, Count>(Fixed.data());
+	bool Reversed = Fixed == Expected;
+	for(
+		std::size_t Level = 0;
+		Level < static_cast<std::size_t>(qreverse::Tier::Count); ++Level
+	)
+	{
+		const qreverse::ReverseFixedProc Proc =
+			qreverse::GetReverseFixedProc<ELEMENTSIZE, Count>(
+				qreverse::Tier(Level)
+			);
+		if( Proc )
+		{
+			Fixed = Original;
+			Proc(Fixed.data());
+			Reversed &= Fixed == Expected;
+		}
+	}
+	return Reversed;
+}
+
+int main(int argc, char* argv[])
+{
+	if( argc < 2 )
+	{
+		std::cout << "Usage: Verify# (Element Count)"
+			<< std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::size_t ElementCount;
+
+	ElementCount = std::strtoull(argv[1], nullptr, 10);
+
+	if( ElementCount == 0 || ElementCount == ULLONG_MAX )
+	{
+		return EXIT_FAILURE;
+	}
+
+	std::vector<std::uint8_t> Array(ELEMENTSIZE * ElementCount);
+
+	std::cout << "Original: " << std::endl;
+	for( std::size_t i = 0; i < ElementCount; ++i )
+	{
+		std::uint8_t* Element = &Array[i * ELEMENTSIZE];
+		for( std::size_t j = 0; j < ELEMENTSIZE; ++j )
+		{
+			Element[j] = static_cast<std::uint8_t>(i);
+			std::cout << +Element[j] << ' ';
+		}
+	}
+
+	std::cout << std::endl;
+
+	std::vector<std::uint8_t> Reversed(Array);
+
+	qReverse<ELEMENTSIZE>(Reversed.data(), ElementCount);
+
+	std::cout << "Reversed: " << std::endl;
+	for( std::size_t i = 0; i < ElementCount; ++i )
+	{
+		std::uint8_t* Element = &Reversed[i * ELEMENTSIZE];
+		for( std::size_t j = 0; j < ELEMENTSIZE; ++j )
+		{
+			std::cout << +Element[j] << ' ';
+		}
+	}
+
+	std::cout << std::endl;
+
+	// Verify proper reversal
+	for( std::size_t i = 0; i < ElementCount; ++i )
+	{
+		const std::uint8_t* OriginalElem = &Array[(ElementCount - i - 1) * ELEMENTSIZE];
+		const std::uint8_t* ReversedElem = &Reversed[i * ELEMENTSIZE];
+		for( std::size_t j = 0; j < ELEMENTSIZE; ++j )
+		{
+			if( OriginalElem[j] != ReversedElem[j] )
+			{
+				// Mismatch, not reversed
+				std::cout << "[FAIL] Array Not Reversed" << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+#if defined(QREVERSE_STATS)
+	// Verify that every element but a middle one is counted once
+	{
+		qreverse::ResetReverseStats<ELEMENTSIZE>();
+		std::vector<std::uint8_t> Counted(Array);
+		qReverse<ELEMENTSIZE>(Counted.data(), ElementCount);
+		const qreverse::ReverseStats Stats =
+			qreverse::GetReverseStats<ELEMENTSIZE>();
+		std::uint64_t Elements = 0;
+		for( const qreverse::TierStats& Level : Stats.Tiers )
+		{
+			Elements += Level.Elements;
+		}
+		if( Elements != ElementCount / 2 * 2 )
+		{
+			std::cout << "[FAIL] Elements Not Counted" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+#endif
+
+	// Verify out-of-place reversal
+	std::vector<std::uint8_t> Copied(Array.size());
+
+	qReverseCopy<ELEMENTSIZE>(Array.data(), Copied.data(), ElementCount);
+
+	if( Copied != Reversed )
+	{
+		std::cout << "[FAIL] Array Not Reverse-Copied" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// Into a destination at every offset within a cache line, so that copies
+	// large enough to be streamed have to peel their tail first
+	for( std::size_t Offset = 1; Offset < 64; ++Offset )
+	{
+		std::vector<std::uint8_t> Misaligned(Array.size() + 64);
+		qReverseCopy<ELEMENTSIZE>(
+			Array.data(), Misaligned.data() + Offset, ElementCount
+		);
+		if(
+			!std::equal(
+				Reversed.begin(), Reversed.end(), Misaligned.begin() + Offset
+			)
+		)
+		{
+			std::cout << "[FAIL] Array Not Reverse-Copied" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Verify parallel reversal, repeating the array until it is large enough
+	// to be split across threads
+	const std::size_t Repeats =
+		qreverse::ParallelThreshold / Array.size() + 1;
+	std::vector<std::uint8_t> Large;
+	for( std::size_t i = 0; i < Repeats; ++i )
+	{
+		Large.insert(Large.end(), Array.begin(), Array.end());
+	}
+	std::vector<std::uint8_t> LargeReversed(Large.size());
+	qReverseCopy<ELEMENTSIZE>(
+		Large.data(), LargeReversed.data(), ElementCount * Repeats
+	);
+
+	qreverse::ThreadPool Pool(4);
+	qReverseParallel<ELEMENTSIZE>(Large.data(), ElementCount * Repeats, Pool);
+
+	if( Large != LargeReversed )
+	{
+		std::cout << "[FAIL] Array Not Reversed In Parallel" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+#if defined(__linux__)
+	// Verify reversal across the NUMA nodes of the machine, in-place as well
+	// as into a destination that is first touched by the reversal itself
+	{
+		qreverse::NumaPool Numa;
+		std::unique_ptr<std::uint8_t[]> NumaCopied(
+			new std::uint8_t[Large.size()]
+		);
+		qReverseCopyParallelNuma<ELEMENTSIZE>(
+			LargeReversed.data(), NumaCopied.get(), ElementCount * Repeats, Numa
+		);
+		std::vector<std::uint8_t> NumaReversed(
+			NumaCopied.get(), NumaCopied.get() + Large.size()
+		);
+		qReverseParallelNuma<ELEMENTSIZE>(
+			NumaReversed.data(), ElementCount * Repeats, Numa
+		);
+		bool Repeated = true;
+		for( std::size_t i = 0; i < Large.size() && Repeated; ++i )
+		{
+			Repeated = NumaCopied[i] == Array[i % Array.size()];
+		}
+		if( !Numa.NodeCount() || !Repeated || NumaReversed != LargeReversed )
+		{
+			std::cout << "[FAIL] Array Not Reversed Across Nodes" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Verify reverse-copying into a buffer backed by huge pages, and reversing
+	// it back in-place, against one with the base pages of the machine
+	for(
+		const qreverse::PageBacking Largest :
+		{qreverse::PageBacking::Huge1G, qreverse::PageBacking::Small}
+	)
+	{
+		const qreverse::HugeBuffer Huge = qReverseCopyHuge<ELEMENTSIZE>(
+			LargeReversed.data(), ElementCount * Repeats, Largest
+		);
+		const std::uint8_t* Huge8 =
+			reinterpret_cast<const std::uint8_t*>(Huge.Data());
+		bool Repeated = Huge8 && Huge.Size() == Large.size()
+			&& Huge.Backing() <= Largest;
+		for( std::size_t i = 0; i < Large.size() && Repeated; ++i )
+		{
+			Repeated = Huge8[i] == Array[i % Array.size()];
+		}
+		if( Repeated )
+		{
+			qReverse<ELEMENTSIZE>(Huge.Data(), ElementCount * Repeats);
+		}
+		if(
+			!Repeated
+			|| std::memcmp(Huge.Data(), LargeReversed.data(), Large.size())
+		)
+		{
+			std::cout << "[FAIL] Array Not Reversed Into Huge Pages" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+#endif
+
+	// Verify asynchronous reversal, undoing the parallel one
+	std::atomic<bool> Called(false);
+	const qreverse::AsyncReverse Async = qReverseAsync<ELEMENTSIZE>(
+		Large.data(), ElementCount * Repeats, Pool,
+		[&](bool Completed){ Called = Completed; }
+	);
+	if( !Async.Wait() || !Called || Async.Progress() != 1.0 )
+	{
+		std::cout << "[FAIL] Array Not Reversed Asynchronously" << std::endl;
+		return EXIT_FAILURE;
+	}
+	qReverse<ELEMENTSIZE>(Large.data(), ElementCount * Repeats);
+	if( Large != LargeReversed )
+	{
+		std::cout << "[FAIL] Array Not Reversed Asynchronously" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// A cancelled reversal still comes to an end
+	qreverse::AsyncReverse Cancelled = qReverseAsync<ELEMENTSIZE>(
+		Large.data(), ElementCount * Repeats, Pool
+	);
+	Cancelled.Cancel();
+	if( Cancelled.Wait() != (Cancelled.Completed() == Cancelled.ChunkCount()) )
+	{
+		std::cout << "[FAIL] Asynchronous Reversal Not Cancelled" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// Verify a reversed view of the large array, which reads back as the
+	// original array over and over. Elements are read out of order so that
+	// tiles get evicted and filled again.
+	{
+		const std::size_t Total = ElementCount * Repeats;
+		qreverse::ReversedView<ELEMENTSIZE> View =
+			qReversedView<ELEMENTSIZE>(LargeReversed.data(), Total);
+		bool Viewed = View.Size() == Total;
+		for( std::size_t Pass = 0; Pass < 2; ++Pass )
+		{
+			for( std::size_t i = Pass; i < Total && Viewed; i += 997 )
+			{
+				Viewed = !std::memcmp(
+					View.At(Total - i - 1),
+					&Array[((Total - i - 1) % ElementCount) * ELEMENTSIZE],
+					ELEMENTSIZE
+				);
+			}
+		}
+		for( std::size_t i = 0; i < Total && Viewed; )
+		{
+			std::size_t Length;
+			const std::uint8_t* Run = reinterpret_cast<const std::uint8_t*>(
+				View.Block(i, Length)
+			);
+			for( std::size_t k = 0; k < Length && Viewed; ++k, ++i )
+			{
+				Viewed = !std::memcmp(
+					&Run[k * ELEMENTSIZE],
+					&Array[(i % ElementCount) * ELEMENTSIZE], ELEMENTSIZE
+				);
+			}
+		}
+		std::vector<std::uint8_t> Copied(Array.size());
+		View.CopyOut(
+			Repeats / 2 * ElementCount, ElementCount, Copied.data()
+		);
+		if( !Viewed || Copied != Array )
+		{
+			std::cout << "[FAIL] Array Not Viewed In Reverse" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Verify 2D reversal of an image with an odd number of rows, both with
+	// and without padding between the rows
+	const std::size_t Height = 3;
+	const std::size_t RowSize = ElementCount * ELEMENTSIZE;
+	for( const std::size_t RowPitch : {RowSize, RowSize + 3} )
+	{
+		std::vector<std::uint8_t> Image(RowPitch * Height);
+		for( std::size_t i = 0; i < Image.size(); ++i )
+		{
+			Image[i] = static_cast<std::uint8_t>(i * 7);
+		}
+
+		for(
+			const qreverse::Axis Axis : {
+				qreverse::Axis::Horizontal,
+				qreverse::Axis::Vertical,
+				qreverse::Axis::Both
+			}
+		)
+		{
+			std::vector<std::uint8_t> Flipped(Image);
+			qReverse2D<ELEMENTSIZE>(
+				Flipped.data(), ElementCount, Height, RowPitch, Axis
+			);
+
+			for( std::size_t y = 0; y < Height; ++y )
+			{
+				const std::size_t SrcY =
+					Axis != qreverse::Axis::Horizontal ? Height - y - 1 : y;
+				for( std::size_t x = 0; x < ElementCount; ++x )
+				{
+					const std::size_t SrcX =
+						Axis != qreverse::Axis::Vertical ? ElementCount - x - 1 : x;
+					for( std::size_t j = 0; j < ELEMENTSIZE; ++j )
+					{
+						if(
+							Flipped[y * RowPitch + x * ELEMENTSIZE + j]
+							!= Image[SrcY * RowPitch + SrcX * ELEMENTSIZE + j]
+						)
+						{
+							std::cout << "[FAIL] Image Not Reversed" << std::endl;
+							return EXIT_FAILURE;
+						}
+					}
+				}
+				// Padding must be left untouched
+				for( std::size_t i = RowSize; i < RowPitch; ++i )
+				{
+					if( Flipped[y * RowPitch + i] != Image[y * RowPitch + i] )
+					{
+						std::cout << "[FAIL] Image Padding Overwritten" << std::endl;
+						return EXIT_FAILURE;
+					}
+				}
+			}
+		}
+	}
+
+	// Verify byteswapping, on a pattern that differs within each element
+	std::vector<std::uint8_t> Bytes(Array.size());
+	for( std::size_t i = 0; i < Bytes.size(); ++i )
+	{
+		Bytes[i] = static_cast<std::uint8_t>(i * 7);
+	}
+
+	std::vector<std::uint8_t> Swapped(Bytes);
+	qByteswap<ELEMENTSIZE>(Swapped.data(), ElementCount);
+	for( std::size_t i = 0; i < ElementCount; ++i )
+	{
+		for( std::size_t j = 0; j < ELEMENTSIZE; ++j )
+		{
+			if(
+				Swapped[i * ELEMENTSIZE + j]
+				!= Bytes[i * ELEMENTSIZE + ELEMENTSIZE - j - 1]
+			)
+			{
+				std::cout << "[FAIL] Array Not Byteswapped" << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+	std::vector<std::uint8_t> ReverseSwapped(Bytes);
+	qReverseByteswap<ELEMENTSIZE>(ReverseSwapped.data(), ElementCount);
+	for( std::size_t i = 0; i < Bytes.size(); ++i )
+	{
+		if( ReverseSwapped[i] != Bytes[Bytes.size() - i - 1] )
+		{
+			std::cout << "[FAIL] Array Not Reverse-Byteswapped" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Verify sub-range reversal, leaving the elements outside of it alone
+	if( ElementCount > 2 )
+	{
+		std::vector<std::uint8_t> Range(Bytes);
+		qReverseRange<ELEMENTSIZE>(Range.data(), 1, ElementCount - 1);
+		std::vector<std::uint8_t> RangeExpected(Bytes);
+		qReverseCopy<ELEMENTSIZE>(
+			&Bytes[ELEMENTSIZE], &RangeExpected[ELEMENTSIZE], ElementCount - 2
+		);
+		if( Range != RangeExpected )
+		{
+			std::cout << "[FAIL] Range Not Reversed" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Verify rotation, both through the staging buffer and through reversals
+	// once the array is repeated to be larger than it
+	const std::size_t Shifts[] = {0, 1, ElementCount / 2, ElementCount - 1};
+	for( const std::size_t Shift : Shifts )
+	{
+		for( const std::vector<std::uint8_t>* Source : {&Bytes, &Large} )
+		{
+			const std::size_t Count = Source->size() / ELEMENTSIZE;
+			// Scaled along with the repeats of the array
+			const std::size_t Scaled = Shift * (Count / ElementCount);
+			std::vector<std::uint8_t> Rotated(*Source);
+			qRotate<ELEMENTSIZE>(Rotated.data(), Count, Scaled);
+			std::vector<std::uint8_t> RotatedExpected(*Source);
+			std::rotate(
+				RotatedExpected.begin(),
+				RotatedExpected.begin() + Scaled * ELEMENTSIZE,
+				RotatedExpected.end()
+			);
+			if( Rotated != RotatedExpected )
+			{
+				std::cout << "[FAIL] Array Not Rotated" << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+	// Verify reversal into separate planes of interleaved frames, and back out
+	// of them, at the plane counts with and without shuffles of their own
+	for( std::size_t PlaneCount = 1; PlaneCount <= 4; ++PlaneCount )
+	{
+		std::vector<std::uint8_t> Frames(Array.size() * PlaneCount);
+		for( std::size_t i = 0; i < Frames.size(); ++i )
+		{
+			Frames[i] = static_cast<std::uint8_t>(i * 7);
+		}
+		std::vector<std::vector<std::uint8_t>> Planes(
+			PlaneCount, std::vector<std::uint8_t>(Array.size())
+		);
+		std::vector<void*> PlanePtrs;
+		for( std::vector<std::uint8_t>& Plane : Planes )
+		{
+			PlanePtrs.push_back(Plane.data());
+		}
+		qReverseDeinterleave<ELEMENTSIZE>(
+			Frames.data(), PlanePtrs.data(), PlaneCount, ElementCount
+		);
+		for( std::size_t k = 0; k < PlaneCount; ++k )
+		{
+			for( std::size_t i = 0; i < Array.size(); ++i )
+			{
+				const std::size_t Frame = ElementCount - i / ELEMENTSIZE - 1;
+				if(
+					Planes[k][i] != Frames[
+						(Frame * PlaneCount + k) * ELEMENTSIZE + i % ELEMENTSIZE
+					]
+				)
+				{
+					std::cout << "[FAIL] Array Not Reverse-Deinterleaved" << std::endl;
+					return EXIT_FAILURE;
+				}
+			}
+		}
+
+		// Reversing the planes again restores the order of the frames
+		qReversePlanes<ELEMENTSIZE>(PlanePtrs.data(), PlaneCount, ElementCount);
+		for( std::size_t k = 0; k < PlaneCount; ++k )
+		{
+			for( std::size_t i = 0; i < Array.size(); ++i )
+			{
+				const std::size_t Frame = i / ELEMENTSIZE;
+				if(
+					Planes[k][i] != Frames[
+						(Frame * PlaneCount + k) * ELEMENTSIZE + i % ELEMENTSIZE
+					]
+				)
+				{
+					std::cout << "[FAIL] Planes Not Reversed" << std::endl;
+					return EXIT_FAILURE;
+				}
+			}
+		}
+	}
+
+	// Verify batched reversal of arrays of every count up to this one, as well
+	// as of a strided batch of arrays of this count with padding between them
+	{
+		std::vector<std::uint8_t> Batch;
+		std::vector<std::uint8_t> BatchExpected;
+		std::vector<std::size_t> Offsets;
+		std::vector<std::size_t> Counts;
+		for( std::size_t Count = 1; Count <= ElementCount; ++Count )
+		{
+			Offsets.push_back(Batch.size());
+			Counts.push_back(Count);
+			Batch.insert(
+				Batch.end(), Bytes.begin(), Bytes.begin() + Count * ELEMENTSIZE
+			);
+			BatchExpected.resize(Batch.size());
+			qReverseCopy<ELEMENTSIZE>(
+				&Batch[Offsets.back()], &BatchExpected[Offsets.back()], Count
+			);
+		}
+		std::vector<void*> Arrays;
+		for( const std::size_t Offset : Offsets )
+		{
+			Arrays.push_back(&Batch[Offset]);
+		}
+		qReverseBatch<ELEMENTSIZE>(Arrays.data(), Counts.data(), Counts.size());
+		if( Batch != BatchExpected )
+		{
+			std::cout << "[FAIL] Batch Not Reversed" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		const std::size_t Stride = RowSize + 3;
+		std::vector<std::uint8_t> Strided(Stride * ElementCount);
+		for( std::size_t i = 0; i < Strided.size(); ++i )
+		{
+			Strided[i] = static_cast<std::uint8_t>(i * 7);
+		}
+		std::vector<std::uint8_t> StridedExpected(Strided);
+		for( std::size_t k = 0; k < ElementCount; ++k )
+		{
+			qReverse<ELEMENTSIZE>(&StridedExpected[k * Stride], ElementCount);
+		}
+		qReverseBatchStrided<ELEMENTSIZE>(
+			Strided.data(), ElementCount, Stride, ElementCount
+		);
+		if( Strided != StridedExpected )
+		{
+			std::cout << "[FAIL] Strided Batch Not Reversed" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Verify adaptive reversal, following a plan that leads each size bucket
+	// with a different one of the supported tiers, after a round trip through
+	// a plan cache file
+	{
+		std::vector<qreverse::Tier> Supported;
+		for(
+			std::size_t Level = 0;
+			Level < static_cast<std::size_t>(qreverse::Tier::Count); ++Level
+		)
+		{
+			if( qreverse::GetReverseProc<ELEMENTSIZE>(qreverse::Tier(Level)) )
+			{
+				Supported.push_back(qreverse::Tier(Level));
+			}
+		}
+		qreverse::ReversePlan Plan;
+		for( std::size_t Bucket = 0; Bucket < qreverse::PlanBuckets; ++Bucket )
+		{
+			Plan.Tiers[Bucket] = Supported[Bucket % Supported.size()];
+		}
+		const std::string PlanPath = "VerifyPlan" + std::to_string(ELEMENTSIZE)
+			+ "-" + std::to_string(ElementCount);
+		qreverse::ReversePlan Loaded;
+		const bool RoundTrip =
+			qreverse::SaveReversePlan<ELEMENTSIZE>(PlanPath.c_str(), Plan)
+			&& qreverse::LoadReversePlan<ELEMENTSIZE>(PlanPath.c_str(), Loaded)
+			&& !qreverse::LoadReversePlan<ELEMENTSIZE + 1>(
+				PlanPath.c_str(), Loaded
+			);
+		std::remove(PlanPath.c_str());
+		if(
+			!RoundTrip
+			|| !std::equal(
+				Plan.Tiers, Plan.Tiers + qreverse::PlanBuckets, Loaded.Tiers
+			)
+		)
+		{
+			std::cout << "[FAIL] Plan Not Saved" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		qreverse::SetReversePlan<ELEMENTSIZE>(Loaded);
+		std::vector<std::uint8_t> Adaptive(Array);
+		qReverseAdaptive<ELEMENTSIZE>(Adaptive.data(), ElementCount);
+		if( Adaptive != Reversed )
+		{
+			std::cout << "[FAIL] Array Not Reversed Adaptively" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		const qreverse::ReversePlan Calibrated =
+			qreverse::CalibrateReversePlan<ELEMENTSIZE>(1024);
+		for( std::size_t Bucket = 0; Bucket < qreverse::PlanBuckets; ++Bucket )
+		{
+			if( !qreverse::GetReverseProc<ELEMENTSIZE>(Calibrated.Tiers[Bucket]) )
+			{
+				std::cout << "[FAIL] Plan Not Calibrated" << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+	// Verify fixed-count reversal of counts about the width of each register
+	if(
+		!VerifyFixed<1>() || !VerifyFixed<5>() || !VerifyFixed<16>()
+		|| !VerifyFixed<17>() || !VerifyFixed<32>() || !VerifyFixed<50>()
+		|| !VerifyFixed<64>() || !VerifyFixed<100>()
+	)
+	{
+		std::cout << "[FAIL] Fixed Array Not Reversed" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+#if defined(__unix__) || defined(__APPLE__)
+	// Verify file reversal, with windows small enough that the array spans
+	// several of them on each end along with a middle left over
+	if( std::FILE* Temp = std::tmpfile() )
+	{
+		std::fwrite(Bytes.data(), 1, Bytes.size(), Temp);
+		std::fflush(Temp);
+		const bool Reversed = qReverseFile<ELEMENTSIZE>(
+			fileno(Temp), 2 * ELEMENTSIZE
+		);
+		std::vector<std::uint8_t> FileReversed(Bytes.size());
+		std::rewind(Temp);
+		const std::size_t Read =
+			std::fread(FileReversed.data(), 1, FileReversed.size(), Temp);
+		std::fclose(Temp);
+
+		std::vector<std::uint8_t> FileExpected(Bytes.size());
+		qReverseCopy<ELEMENTSIZE>(Bytes.data(), FileExpected.data(), ElementCount);
+		if( !Reversed || Read != Bytes.size() || FileReversed != FileExpected )
+		{
+			std::cout << "[FAIL] File Not Reversed" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+#endif
+
+	// Verify the typed front-end, for trivially copyable elements of this size
+	// as well as ones it has to hand off to std::reverse
+	struct ElementType
+	{
+		std::uint8_t u8[ELEMENTSIZE];
+	};
+	std::vector<ElementType> Typed(ElementCount);
+	std::copy(
+		Array.begin(), Array.end(),
+		reinterpret_cast<std::uint8_t*>(Typed.data())
+	);
+	qreverse::reverse(Typed);
+	if(
+		!std::equal(
+			Reversed.begin(), Reversed.end(),
+			reinterpret_cast<const std::uint8_t*>(Typed.data())
+		)
+	)
+	{
+		std::cout << "[FAIL] Typed Array Not Reversed" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::vector<std::string> Strings(ElementCount);
+	for( std::size_t i = 0; i < ElementCount; ++i )
+	{
+		Strings[i] = std::string(ELEMENTSIZE, static_cast<char>('a' + i % 26));
+	}
+	std::vector<std::string> StringsReversed(Strings.rbegin(), Strings.rend());
+	qreverse::reverse(Strings.data(), Strings.data() + Strings.size());
+	if( Strings != StringsReversed )
+	{
+		std::cout << "[FAIL] Typed Array Not Reversed" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// Containers, including a string whose storage is only reachable for
+	// writing through its front element before C++17, and an empty one
+	std::string Text(Strings.size(), ' ');
+	for( std::size_t i = 0; i < Text.size(); ++i )
+	{
+		Text[i] = Strings[i][0];
+	}
+	std::string TextReversed(Text.rbegin(), Text.rend());
+	std::vector<ElementType> Empty;
+	qreverse::reverse(Text);
+	qreverse::reverse(Empty);
+	if( Text != TextReversed || !Empty.empty() )
+	{
+		std::cout << "[FAIL] Typed Container Not Reversed" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// Successfully reversed
+	std::cout << "[PASS] Array Reversed" << std::endl;
+	return EXIT_SUCCESS;
 }
\ No newline at end of file
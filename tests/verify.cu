@@ -0,0 +1,109 @@
+#include <cstdint>
+#include <cstddef>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <qreverse/cuda.cuh>
+
+/*
+For use with cmake:
+	Verifies that qreverse can properly reverse an array of device memory at
+	the designated compile-time element size.
+
+	Define ELEMENTSIZE preprocessor value to adjust verified element size
+*/
+
+#ifndef ELEMENTSIZE
+#define ELEMENTSIZE 1
+#endif
+
+int main(int argc, char* argv[])
+{
+	if( argc < 2 )
+	{
+		std::cout << "Usage: VerifyCUDA# (Element Count)"
+			<< std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::size_t ElementCount;
+
+	ElementCount = std::strtoull(argv[1], nullptr, 10);
+
+	if( ElementCount == 0 || ElementCount == ULLONG_MAX )
+	{
+		return EXIT_FAILURE;
+	}
+
+	std::vector<std::uint8_t> Array(ELEMENTSIZE * ElementCount);
+	for( std::size_t i = 0; i < ElementCount; ++i )
+	{
+		for( std::size_t j = 0; j < ELEMENTSIZE; ++j )
+		{
+			Array[i * ELEMENTSIZE + j] = static_cast<std::uint8_t>(i + j);
+		}
+	}
+
+	std::vector<std::uint8_t> Expected(Array.size());
+	for( std::size_t i = 0; i < ElementCount; ++i )
+	{
+		for( std::size_t j = 0; j < ELEMENTSIZE; ++j )
+		{
+			Expected[i * ELEMENTSIZE + j] =
+				Array[(ElementCount - i - 1) * ELEMENTSIZE + j];
+		}
+	}
+
+	void* Device = nullptr;
+	void* DeviceCopy = nullptr;
+	if(
+		cudaMalloc(&Device, Array.size()) != cudaSuccess
+		|| cudaMalloc(&DeviceCopy, Array.size()) != cudaSuccess
+	)
+	{
+		std::cout << "[FAIL] Unable to allocate device memory" << std::endl;
+		return EXIT_FAILURE;
+	}
+	cudaMemcpy(Device, Array.data(), Array.size(), cudaMemcpyHostToDevice);
+
+	// Verify out-of-place reversal
+	std::vector<std::uint8_t> Reversed(Array.size());
+	if( qReverseCopyDevice<ELEMENTSIZE>(Device, DeviceCopy, ElementCount) )
+	{
+		std::cout << "[FAIL] Unable to reverse-copy device memory" << std::endl;
+		return EXIT_FAILURE;
+	}
+	cudaMemcpy(
+		Reversed.data(), DeviceCopy, Reversed.size(), cudaMemcpyDeviceToHost
+	);
+	if( Reversed != Expected )
+	{
+		std::cout << "[FAIL] Array Not Reverse-Copied" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// Verify in-place reversal, queued on a stream of its own
+	cudaStream_t Stream;
+	cudaStreamCreate(&Stream);
+	if( qReverseDeviceAsync<ELEMENTSIZE>(Device, ElementCount, Stream) )
+	{
+		std::cout << "[FAIL] Unable to reverse device memory" << std::endl;
+		return EXIT_FAILURE;
+	}
+	cudaStreamSynchronize(Stream);
+	cudaStreamDestroy(Stream);
+	cudaMemcpy(Reversed.data(), Device, Reversed.size(), cudaMemcpyDeviceToHost);
+	if( Reversed != Expected )
+	{
+		std::cout << "[FAIL] Array Not Reversed" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	cudaFree(Device);
+	cudaFree(DeviceCopy);
+
+	std::cout << "[PASS]" << std::endl;
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,62 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <iostream>
+
+#include <qreverse/file.hpp>
+
+/*
+Reverses the elements of a file in-place, such as to reverse a raw capture of
+audio samples for playback, without ever holding more than two windows of it
+in memory.
+
+	Usage: ReverseFile (Element Size) (Path) [Window Size]
+*/
+
+template< std::size_t ElementSize >
+bool Reverse(const char* Path, std::size_t WindowSize)
+{
+	return qReverseFile<ElementSize>(Path, WindowSize);
+}
+
+int main(int argc, char* argv[])
+{
+	if( argc < 3 )
+	{
+		std::cout << "Usage: ReverseFile (Element Size) (Path) [Window Size]"
+			<< std::endl;
+		return EXIT_FAILURE;
+	}
+
+	const std::size_t ElementSize = std::strtoull(argv[1], nullptr, 10);
+	const char* Path = argv[2];
+	const std::size_t WindowSize = argc > 3
+		? std::strtoull(argv[3], nullptr, 10) : qreverse::FileWindowSize;
+
+	bool Reversed;
+	switch( ElementSize )
+	{
+	case 1:  Reversed = Reverse< 1>(Path, WindowSize); break;
+	case 2:  Reversed = Reverse< 2>(Path, WindowSize); break;
+	case 3:  Reversed = Reverse< 3>(Path, WindowSize); break;
+	case 4:  Reversed = Reverse< 4>(Path, WindowSize); break;
+	case 6:  Reversed = Reverse< 6>(Path, WindowSize); break;
+	case 8:  Reversed = Reverse< 8>(Path, WindowSize); break;
+	case 12: Reversed = Reverse<12>(Path, WindowSize); break;
+	case 16: Reversed = Reverse<16>(Path, WindowSize); break;
+	case 24: Reversed = Reverse<24>(Path, WindowSize); break;
+	default:
+		std::cout << "Unsupported element size: " << ElementSize << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	if( !Reversed )
+	{
+		std::cout << "Unable to reverse " << Path << ": "
+			<< std::strerror(errno) << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}